@@ -0,0 +1,158 @@
+// alt.c
+#include "alt.h"
+#include "dijkstra.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define INF DIJKSTRA_INF
+
+static const char ALT_MAGIC[4] = { 'A', 'L', 'T', '1' };
+
+static ALTData* alt_alloc(int n, int k, int directed) {
+    ALTData* a = (ALTData*)malloc(sizeof(ALTData));
+    a->n = n;
+    a->k = k;
+    a->directed = directed;
+    a->landmarks = (int*)malloc(sizeof(int) * (size_t)(k > 0 ? k : 1));
+    a->from = (long long*)malloc(sizeof(long long) * (size_t)n * (size_t)(k > 0 ? k : 1));
+    a->to = directed ? (long long*)malloc(sizeof(long long) * (size_t)n * (size_t)(k > 0 ? k : 1))
+                     : a->from;
+    return a;
+}
+
+ALTData* alt_build(const Graph* g, const Graph* rev, int k, const PQOps* ops) {
+    int n = g->n;
+    int directed = g->directed;
+    if (directed && !rev) {
+        fprintf(stderr, "alt_build: directed graph needs its reverse graph for to-landmark distances\n");
+        exit(1);
+    }
+    if (k > n) k = n;
+    ALTData* a = alt_alloc(n, k, directed);
+
+    // min_d[v]: distance from v to the nearest chosen landmark (selection score)
+    long long* min_d = (long long*)malloc(sizeof(long long) * n);
+
+    // Seed: the vertex farthest from vertex 0
+    DijkstraResult seed = dijkstra_run(g, 0, ops);
+    int next = 0;
+    for (int v = 0; v < n; v++) {
+        min_d[v] = INF;
+        if (seed.dist[v] < INF && seed.dist[v] > seed.dist[next]) next = v;
+    }
+    dijkstra_free(seed);
+
+    for (int i = 0; i < k; i++) {
+        int L = next;
+        a->landmarks[i] = L;
+
+        DijkstraResult f = dijkstra_run(g, L, ops);
+        for (int v = 0; v < n; v++) a->from[(size_t)v * k + i] = f.dist[v];
+        dijkstra_free(f);
+
+        if (directed) {
+            DijkstraResult b = dijkstra_run(rev, L, ops);
+            for (int v = 0; v < n; v++) a->to[(size_t)v * k + i] = b.dist[v];
+            dijkstra_free(b);
+        }
+
+        // Next landmark: the reachable vertex farthest from all chosen ones
+        next = L;
+        long long best = -1;
+        for (int v = 0; v < n; v++) {
+            long long d = a->from[(size_t)v * k + i];
+            if (d < min_d[v]) min_d[v] = d;
+            if (min_d[v] < INF && min_d[v] > best) { best = min_d[v]; next = v; }
+        }
+    }
+
+    free(min_d);
+    return a;
+}
+
+void alt_destroy(ALTData* a) {
+    if (a->to != a->from) free(a->to);
+    free(a->from);
+    free(a->landmarks);
+    free(a);
+}
+
+int alt_save(const ALTData* a, const char* path) {
+    FILE* f = fopen(path, "wb");
+    if (!f) return -1;
+    int hdr[3] = { a->n, a->k, a->directed };
+    size_t cells = (size_t)a->n * (size_t)a->k;
+    int ok = fwrite(ALT_MAGIC, 1, 4, f) == 4
+          && fwrite(hdr, sizeof(int), 3, f) == 3
+          && fwrite(a->landmarks, sizeof(int), (size_t)a->k, f) == (size_t)a->k
+          && fwrite(a->from, sizeof(long long), cells, f) == cells
+          && (!a->directed || fwrite(a->to, sizeof(long long), cells, f) == cells);
+    if (fclose(f) != 0) ok = 0;
+    return ok ? 0 : -1;
+}
+
+ALTData* alt_load(const char* path) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return NULL;
+    char magic[4];
+    int hdr[3];
+    if (fread(magic, 1, 4, f) != 4 || memcmp(magic, ALT_MAGIC, 4) != 0
+        || fread(hdr, sizeof(int), 3, f) != 3 || hdr[0] < 0 || hdr[1] < 0) {
+        fclose(f);
+        return NULL;
+    }
+    ALTData* a = alt_alloc(hdr[0], hdr[1], hdr[2]);
+    size_t cells = (size_t)a->n * (size_t)a->k;
+    int ok = fread(a->landmarks, sizeof(int), (size_t)a->k, f) == (size_t)a->k
+          && fread(a->from, sizeof(long long), cells, f) == cells
+          && (!a->directed || fread(a->to, sizeof(long long), cells, f) == cells);
+    fclose(f);
+    if (!ok) { alt_destroy(a); return NULL; }
+    return a;
+}
+
+long long alt_lower_bound(const ALTData* a, int v, int t) {
+    const long long* fv = a->from + (size_t)v * a->k;
+    const long long* ft = a->from + (size_t)t * a->k;
+    const long long* tv = a->to + (size_t)v * a->k;
+    const long long* tt = a->to + (size_t)t * a->k;
+    long long h = 0;
+    for (int i = 0; i < a->k; i++) {
+        // d(v,t) >= d(L,t) - d(L,v). L reaches v but not t: v cannot reach t.
+        if (fv[i] < INF) {
+            if (ft[i] >= INF) return INF;
+            if (ft[i] - fv[i] > h) h = ft[i] - fv[i];
+        }
+        // d(v,t) >= d(v,L) - d(t,L). t reaches L but v does not: v cannot reach t.
+        if (tt[i] < INF) {
+            if (tv[i] >= INF) return INF;
+            if (tv[i] - tt[i] > h) h = tv[i] - tt[i];
+        }
+    }
+    return h;
+}
+
+STResult alt_query(SearchContext* ctx, const Graph* g, const ALTData* a, int s, int t) {
+    STResult r = { INF, 0 };
+    search_ctx_begin(ctx);
+    long long hs = alt_lower_bound(a, s, t);
+    if (hs >= INF) return r;
+    search_ctx_relax(ctx, s, 0, hs, -1);
+
+    int u;
+    long long key;
+    while (search_ctx_pop(ctx, &u, &key)) {
+        long long du = ctx->dist[u];
+        if (u == t) { r.dist = du; break; }
+        for (Edge* e = g->adj[u]; e; e = e->next) {
+            long long nd = du + e->w;
+            if (nd >= search_ctx_dist(ctx, e->to)) continue;
+            long long h = alt_lower_bound(a, e->to, t);
+            if (h >= INF) continue; // provably cannot reach t
+            search_ctx_relax(ctx, e->to, nd, nd + h, u);
+        }
+    }
+    r.settled = ctx->settled;
+    return r;
+}
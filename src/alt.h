@@ -0,0 +1,39 @@
+// alt.h
+#ifndef ALT_H
+#define ALT_H
+
+#include "graph.h"
+#include "pq.h"
+#include "search_ctx.h"
+#include "st_query.h"
+
+// ALT (A*, Landmarks, Triangle inequality) preprocessing data.
+// Distances are stored per vertex so one heuristic evaluation reads one
+// contiguous block: from[v*k + i] = d(L_i, v), to[v*k + i] = d(v, L_i).
+typedef struct {
+    int n;
+    int k;            // number of landmarks
+    int directed;     // undirected graphs share one table (to == from)
+    int* landmarks;
+    long long* from;
+    long long* to;
+} ALTData;
+
+// Farthest-landmark selection: each landmark runs dijkstra_run once on g
+// (and once on rev for directed graphs). rev may be NULL only when g is
+// undirected; a directed g without rev prints an error and exits.
+ALTData* alt_build(const Graph* g, const Graph* rev, int k, const PQOps* ops);
+void     alt_destroy(ALTData* a);
+
+// Binary landmark tables. Return 0 on success / NULL on error.
+int      alt_save(const ALTData* a, const char* path);
+ALTData* alt_load(const char* path);
+
+// Admissible, consistent lower bound on d(v, t); DIJKSTRA_INF when the
+// tables prove t unreachable from v.
+long long alt_lower_bound(const ALTData* a, int v, int t);
+
+// A* query from s to t driven by the ALT bound, on any PQOps backend (via ctx).
+STResult alt_query(SearchContext* ctx, const Graph* g, const ALTData* a, int s, int t);
+
+#endif
@@ -3,35 +3,41 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <inttypes.h>
+#include <limits.h>
+#include <string.h>
 
 #include "graph.h"
+#include "csr_graph.h"
 #include "dijkstra.h"
 #include "prim.h"
 
 #include "binheap_pq.h"
 #include "fibheap_pq.h"
 #include "pairing_pq.h"
+#include "dary_pq.h"
+#include "radix_pq.h"
+#include "dial_pq.h"
 
 #include "pq_profile.h"
+#include "delta_stepping.h"
+#include "mq_sssp.h"
+#include "dyn_sssp.h"
+#include "dyn_mst.h"
+#include "boruvka_mst.h"
+#include "query_exec.h"
+#include "st_query.h"
+#include "search_ctx.h"
+#include "alt.h"
+#include "ch.h"
+#include "hub_label.h"
+#include "graph_file.h"
+#include "graph_parse.h"
+#include "reorder.h"
+#include "graph_gen.h"
+#include "stats.h"
+#include "min_scan.h"
 
-#ifdef _WIN32
-#include <windows.h>
-static uint64_t now_ns(void) {
-    static LARGE_INTEGER freq;
-    static int init = 0;
-    if (!init) { QueryPerformanceFrequency(&freq); init = 1; }
-    LARGE_INTEGER t;
-    QueryPerformanceCounter(&t);
-    return (uint64_t)((1e9 * (double)t.QuadPart) / (double)freq.QuadPart);
-}
-#else
-#include <time.h>
-static uint64_t now_ns(void) {
-    struct timespec ts;
-    clock_gettime(CLOCK_MONOTONIC, &ts);
-    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
-}
-#endif
+#include "timer.h"
 
 // Simple RNG (repeatable)
 static uint32_t rng_state = 123456789;
@@ -45,128 +51,1438 @@ static int rand_int(int lo, int hi) {
     return lo + (int)(rng_u32() % (uint32_t)(hi - lo + 1));
 }
 
-// Random directed graph with n vertices and m edges, weights in [1,20]
+// Graphs for the fixed-size sections; seeds come from the --seed driven RNG
 static Graph *make_random_graph(int n, int m, int directed) {
-    Graph *g = graph_create(n, directed);
-    for (int i = 0; i < m; i++) {
-        int u = rand_int(0, n - 1);
-        int v = rand_int(0, n - 1);
-        if (u == v) { i--; continue; }
-        int w = rand_int(1, 20);
-        graph_add_edge(g, u, v, w);
-        if (!directed) graph_add_edge(g, v, u, w);
-    }
-    return g;
-}
-
-static void run_case(const char *algo,
-                     const char *heap,
-                     const Graph *g,
-                     const PQOps *base_ops,
-                     int source_or_root) {
-    PQProfile prof;
-    pq_profile_reset(&prof);
-    const PQOps *ops = pq_profile_ops(base_ops, &prof);
+    return graph_generate(GEN_RANDOM, n, m, directed, rng_u32());
+}
 
-    uint64_t t0 = now_ns();
+static Graph *make_grid_graph(int side) {
+    return graph_generate(GEN_GRID, side * side, 0, 1, rng_u32());
+}
+
+typedef struct {
+    const char *name;
+    const PQOps *ops;
+    int monotone_only; // integer monotone queues: Dijkstra only, no Prim
+} HeapEntry;
+
+static const HeapEntry HEAPS[] = {
+    { "Binary",    &BINHEAP_OPS,    0 },
+    { "Fibonacci", &fibheap_pq_ops, 0 },
+    { "Pairing",   &pairing_pq_ops, 0 },
+    { "Dary2",     &DARY2_OPS,      0 },
+    { "Dary4",     &DARY4_OPS,      0 },
+    { "Dary8",     &DARY8_OPS,      0 },
+    { "Radix",     &RADIX_OPS,      1 },
+    { "Dial",      &DIAL_OPS,       1 },
+};
+#define NUM_HEAPS ((int)(sizeof(HEAPS) / sizeof(HEAPS[0])))
+
+// Sections that run a subset of heaps name them, so reordering HEAPS is safe
+static const HeapEntry *find_heap(const char *name) {
+    for (int h = 0; h < NUM_HEAPS; h++)
+        if (strcmp(HEAPS[h].name, name) == 0) return &HEAPS[h];
+    fprintf(stderr, "bench: no heap named %s\n", name);
+    exit(1);
+}
 
+typedef struct {
+    GraphFamily families[GEN_FAMILY_COUNT];
+    int family_count;
+    int sizes[32];
+    int size_count;
+    double degree;    // m = degree * n when m is 0
+    long long m;
+    int directed;
+    uint64_t seed;
+    int trials;
+    int warmup;
+    unsigned suites;  // SUITE_* bits
+    const char *csv_path;
+    const char *json_path;
+    const char *load_path;
+    int hw;           // --hw: collect hardware counters per heap operation
+    PerfCounters perf;
+    int tsc;          // --timing tsc: calibrated cycle-counter reads
+    TscClock tsc_clock;
+    unsigned sample;  // --sample N: time every N-th heap operation
+} BenchOptions;
+
+// One (algo, heap, layout) measurement: wall time plus heap-operation profile.
+static uint64_t run_case(const BenchOptions *opt, const char *algo, const Graph *g,
+                         const CSRGraph *csr, const PQOps *base_ops, int source_or_root,
+                         PQProfile *prof) {
+    pq_profile_reset(prof);
+    pq_profile_attach_counters(prof, opt->hw ? &opt->perf : NULL);
+    pq_profile_set_timing(prof, opt->tsc ? &opt->tsc_clock : NULL, opt->sample);
+    const PQOps *ops = pq_profile_ops(base_ops, prof);
+
+    uint64_t t0 = now_ns();
     if (algo[0] == 'D') {
-        DijkstraResult d = dijkstra_run(g, source_or_root, ops);
+        DijkstraResult d = csr ? dijkstra_run_csr(csr, source_or_root, ops)
+                               : dijkstra_run(g, source_or_root, ops);
         dijkstra_free(d);
     } else {
-        PrimResult p = prim_run(g, source_or_root, ops);
+        PrimResult p = csr ? prim_run_csr(csr, source_or_root, ops)
+                           : prim_run_heap(g, source_or_root, ops);
         prim_free(p);
     }
+    return now_ns() - t0;
+}
 
-    uint64_t t1 = now_ns();
-    uint64_t total_ns = t1 - t0;
+static const char *OP_NAMES[PQ_OP_COUNT] = { "insert", "extract", "decrease", "build" };
+static const char *QUANTILE_NAMES[3] = { "p50", "p99", "p999" };
+static const double QUANTILES[3] = { 0.5, 0.99, 0.999 };
 
-    // CSV columns:
-    // algo,heap,n,total_ns,insert_count,extract_count,decrease_count,insert_ns,extract_ns,decrease_ns
-    printf("%s,%s,%d,%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 "\n",
-           algo, heap, g->n, total_ns,
-           prof.insert_count, prof.extract_count, prof.decrease_count,
-           prof.insert_ns, prof.extract_ns, prof.decrease_ns);
+typedef struct {
+    FILE *csv;
+    FILE *json;
+    int json_rows;
+} BenchOutput;
 
-    fflush(stdout);
+static void output_open(BenchOutput *out, const BenchOptions *opt) {
+    out->csv = stdout;
+    if (opt->csv_path && !(out->csv = fopen(opt->csv_path, "w"))) {
+        fprintf(stderr, "bench: cannot write %s\n", opt->csv_path);
+        exit(1);
+    }
+    fprintf(out->csv, "algo,heap,layout,family,n,m,seed,trials,warmup,"
+                      "median_ns,mad_ns,ci_lo_ns,ci_hi_ns,min_ns,max_ns,mean_ns,"
+                      "insert_count,extract_count,decrease_count,build_count,"
+                      "insert_ns,extract_ns,decrease_ns,build_ns");
+    for (int op = 0; op < PQ_OP_BUILD; op++)
+        for (int q = 0; q < 3; q++) fprintf(out->csv, ",%s_%s_ns", OP_NAMES[op], QUANTILE_NAMES[q]);
+    for (int op = 0; op < PQ_OP_COUNT; op++)
+        for (int k = 0; k < PERF_COUNTER_COUNT; k++)
+            fprintf(out->csv, ",%s_%s", OP_NAMES[op], perf_counter_name(k));
+    fprintf(out->csv, "\n");
+    fflush(out->csv);
+
+    out->json = NULL;
+    out->json_rows = 0;
+    if (opt->json_path) {
+        if (!(out->json = fopen(opt->json_path, "w"))) {
+            fprintf(stderr, "bench: cannot write %s\n", opt->json_path);
+            exit(1);
+        }
+        fprintf(out->json, "{\n  \"config\": {\"seed\": %" PRIu64 ", \"trials\": %d, \"warmup\": %d, "
+                           "\"directed\": %d, \"timing\": \"%s\", \"sample\": %u},\n  \"results\": [",
+                opt->seed, opt->trials, opt->warmup, opt->directed, opt->tsc ? "tsc" : "clock",
+                opt->sample > 1 ? opt->sample : 1);
+    }
 }
 
-int main(void) {
-    // CSV header
-    printf("algo,heap,n,total_ns,insert_count,extract_count,decrease_count,insert_ns,extract_ns,decrease_ns\n");
-    fflush(stdout);
+static void output_close(BenchOutput *out) {
+    if (out->csv != stdout) fclose(out->csv);
+    if (out->json) {
+        fprintf(out->json, "\n  ]\n}\n");
+        fclose(out->json);
+    }
+}
 
-    // DEBUG SETTINGS (small so it won’t feel “forever”)
-    const int sizes[] = {200, 500, 1000};
-    const int trials = 5;
+typedef struct {
+    const char *algo;
+    const char *heap;
+    const char *layout;
+    const char *family;
+    int n;
+    int m;
+    SampleStats total;
+    PQProfile counts;   // operation counts (identical across trials)
+    double op_ns[4];    // median insert / extract / decrease / build ns
+    double op_q[PQ_OP_BUILD][3]; // p50 / p99 / p99.9 latency of single operations (all trials)
+    unsigned hw_mask;   // live hardware counters (0: --hw off or unavailable)
+    double hw[PQ_OP_COUNT][PERF_COUNTER_COUNT]; // median counter totals per op type
+    uint64_t hw_scaled; // timed ops (all trials) with multiplexed, scaled counts
+    uint64_t hw_missed; // timed ops whose counts are unknown (group not running)
+} CaseSummary;
 
-    for (int si = 0; si < (int)(sizeof(sizes) / sizeof(sizes[0])); si++) {
-        int n = sizes[si];
+static void output_row(BenchOutput *out, const BenchOptions *opt, const CaseSummary *c) {
+    const SampleStats *t = &c->total;
+    fprintf(out->csv, "%s,%s,%s,%s,%d,%d,%" PRIu64 ",%d,%d,%.0f,%.0f,%.0f,%.0f,%.0f,%.0f,%.0f,"
+                      "%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%.0f,%.0f,%.0f,%.0f",
+            c->algo, c->heap, c->layout, c->family, c->n, c->m, opt->seed, opt->trials, opt->warmup,
+            t->median, t->mad, t->ci_lo, t->ci_hi, t->min, t->max, t->mean,
+            c->counts.insert_count, c->counts.extract_count, c->counts.decrease_count, c->counts.build_count,
+            c->op_ns[0], c->op_ns[1], c->op_ns[2], c->op_ns[3]);
+    for (int op = 0; op < PQ_OP_BUILD; op++)
+        for (int q = 0; q < 3; q++) fprintf(out->csv, ",%.0f", c->op_q[op][q]);
+    // Unavailable counters are left empty rather than reported as 0
+    for (int op = 0; op < PQ_OP_COUNT; op++) {
+        for (int k = 0; k < PERF_COUNTER_COUNT; k++) {
+            if (c->hw_mask & (1u << k)) fprintf(out->csv, ",%.0f", c->hw[op][k]);
+            else fprintf(out->csv, ",");
+        }
+    }
+    fprintf(out->csv, "\n");
+    fflush(out->csv);
+
+    if (!out->json) return;
+    fprintf(out->json, "%s\n    {\"algo\": \"%s\", \"heap\": \"%s\", \"layout\": \"%s\", \"family\": \"%s\", "
+                       "\"n\": %d, \"m\": %d, \"trials\": %d, "
+                       "\"total_ns\": {\"median\": %.0f, \"mad\": %.0f, \"ci95\": [%.0f, %.0f], "
+                       "\"min\": %.0f, \"max\": %.0f, \"mean\": %.0f}, "
+                       "\"counts\": {\"insert\": %" PRIu64 ", \"extract\": %" PRIu64 ", "
+                       "\"decrease\": %" PRIu64 ", \"build\": %" PRIu64 "}, "
+                       "\"median_op_ns\": {\"insert\": %.0f, \"extract\": %.0f, \"decrease\": %.0f, \"build\": %.0f}, ",
+            out->json_rows++ ? "," : "",
+            c->algo, c->heap, c->layout, c->family, c->n, c->m, opt->trials,
+            t->median, t->mad, t->ci_lo, t->ci_hi, t->min, t->max, t->mean,
+            c->counts.insert_count, c->counts.extract_count, c->counts.decrease_count, c->counts.build_count,
+            c->op_ns[0], c->op_ns[1], c->op_ns[2], c->op_ns[3]);
+    fprintf(out->json, "\"latency_ns\": {");
+    for (int op = 0; op < PQ_OP_BUILD; op++)
+        fprintf(out->json, "%s\"%s\": {\"p50\": %.0f, \"p99\": %.0f, \"p999\": %.0f}", op ? ", " : "",
+                OP_NAMES[op], c->op_q[op][0], c->op_q[op][1], c->op_q[op][2]);
+    fprintf(out->json, "}, \"hw\": ");
+    if (!c->hw_mask) {
+        fprintf(out->json, "null}");
+        return;
+    }
+    fprintf(out->json, "{");
+    for (int op = 0; op < PQ_OP_COUNT; op++) {
+        fprintf(out->json, "%s\"%s\": {", op ? ", " : "", OP_NAMES[op]);
+        int first = 1;
+        for (int k = 0; k < PERF_COUNTER_COUNT; k++) {
+            if (!(c->hw_mask & (1u << k))) continue;
+            fprintf(out->json, "%s\"%s\": %.0f", first ? "" : ", ", perf_counter_name(k), c->hw[op][k]);
+            first = 0;
+        }
+        fprintf(out->json, "}");
+    }
+    fprintf(out->json, "}, \"hw_scaled_ops\": %" PRIu64 ", \"hw_missed_ops\": %" PRIu64 "}",
+            c->hw_scaled, c->hw_missed);
+}
+
+// Warmup runs, then opt->trials timed runs of one case; returns the summary.
+static CaseSummary measure_case(const BenchOptions *opt, const char *algo, const HeapEntry *h,
+                                const Graph *g, const CSRGraph *csr) {
+    CaseSummary c;
+    memset(&c, 0, sizeof(c));
+    c.algo = algo;
+    c.heap = h->name;
+    c.layout = csr ? "csr" : "list";
+
+    PQProfile prof;
+    for (int i = 0; i < opt->warmup; i++) run_case(opt, algo, g, csr, h->ops, 0, &prof);
 
-        // Sparse and “medium-dense” edge counts
-        int m_sparse = 4 * n;    // ~O(n)
-        int m_dense = (n * n) / 8; // NOT n^2 yet (avoid huge runs while debugging)
+    LatencyHist *hist = (LatencyHist *)calloc(PQ_OP_BUILD, sizeof(LatencyHist));
 
-        for (int t = 0; t < trials; t++) {
+    double *total = (double *)malloc(sizeof(double) * (size_t)opt->trials);
+    double *ops[4];
+    for (int k = 0; k < 4; k++) ops[k] = (double *)malloc(sizeof(double) * (size_t)opt->trials);
+    double *hw = (double *)malloc(sizeof(double) * (size_t)opt->trials * PQ_OP_COUNT * PERF_COUNTER_COUNT);
+    for (int i = 0; i < opt->trials; i++) {
+        total[i] = (double)run_case(opt, algo, g, csr, h->ops, 0, &prof);
+        for (int op = 0; op < PQ_OP_BUILD; op++) latency_hist_merge(&hist[op], &prof.hist[op]);
+        ops[0][i] = (double)prof.insert_ns;
+        ops[1][i] = (double)prof.extract_ns;
+        ops[2][i] = (double)prof.decrease_ns;
+        ops[3][i] = (double)prof.build_ns;
+        for (int op = 0; op < PQ_OP_COUNT; op++)
+            for (int k = 0; k < PERF_COUNTER_COUNT; k++)
+                hw[(op * PERF_COUNTER_COUNT + k) * opt->trials + i] = (double)prof.hw[op][k];
+        c.hw_scaled += prof.hw_scaled;
+        c.hw_missed += prof.hw_missed;
+    }
+    c.counts = prof;
+    c.total = sample_stats(total, opt->trials);
+    for (int k = 0; k < 4; k++) {
+        c.op_ns[k] = sample_stats(ops[k], opt->trials).median;
+        free(ops[k]);
+    }
+    c.hw_mask = prof.perf ? prof.perf->mask : 0;
+    if (c.hw_scaled || c.hw_missed)
+        fprintf(stderr, "[hw] %s %s (%s): PMU multiplexed the counters, %" PRIu64 " ops scaled, "
+                        "%" PRIu64 " ops not counted\n", algo, h->name, c.layout, c.hw_scaled, c.hw_missed);
+    for (int op = 0; op < PQ_OP_COUNT; op++)
+        for (int k = 0; k < PERF_COUNTER_COUNT; k++)
+            c.hw[op][k] = sample_stats(hw + (op * PERF_COUNTER_COUNT + k) * opt->trials, opt->trials).median;
+    for (int op = 0; op < PQ_OP_BUILD; op++)
+        for (int q = 0; q < 3; q++) c.op_q[op][q] = latency_hist_quantile(&hist[op], QUANTILES[q]);
+    free(hist);
+    free(hw);
+    free(total);
+    return c;
+}
+
+// Core suite for one graph: Dijkstra and Prim with every heap on both
+// layouts, summarized per case; the CSR speedup goes to stderr.
+static void run_all(const BenchOptions *opt, BenchOutput *out, const char *family, const Graph *g) {
+    CSRGraph *csr = csr_from_graph(g);
+    const char *algos[] = { "Dijkstra", "Prim" };
 
-            // ======================
-            // Sparse graph runs
-            // ======================
-            fprintf(stderr, "\n[progress] building SPARSE graph n=%d m=%d trial=%d\n", n, m_sparse, t);
+    for (int a = 0; a < 2; a++) {
+        for (int h = 0; h < NUM_HEAPS; h++) {
+            if (algos[a][0] == 'P' && HEAPS[h].monotone_only) continue;
+            fprintf(stderr, "[progress] %s %s (%s n=%d)\n", algos[a], HEAPS[h].name, family, g->n);
             fflush(stderr);
-            Graph *gs = make_random_graph(n, m_sparse, 1);
+            CaseSummary list = measure_case(opt, algos[a], &HEAPS[h], g, NULL);
+            CaseSummary flat = measure_case(opt, algos[a], &HEAPS[h], g, csr);
+            list.family = flat.family = family;
+            list.n = flat.n = g->n;
+            list.m = flat.m = csr->m;
+            output_row(out, opt, &list);
+            output_row(out, opt, &flat);
+            fprintf(stderr, "[speedup] %s %s (%s): list=%.0fns csr=%.0fns -> %.2fx\n",
+                    algos[a], HEAPS[h].name, family, list.total.median, flat.total.median,
+                    flat.total.median > 0 ? list.total.median / flat.total.median : 0.0);
+        }
+    }
 
-            fprintf(stderr, "[progress] Dijkstra Binary (sparse)\n"); fflush(stderr);
-            run_case("Dijkstra", "Binary", gs, &BINHEAP_OPS, 0);
+    csr_destroy(csr);
+}
 
-            fprintf(stderr, "[progress] Dijkstra Fibonacci (sparse)\n"); fflush(stderr);
-            run_case("Dijkstra", "Fibonacci", gs, &fibheap_pq_ops, 0);
+// Vertices where a parallel SSSP result disagrees with a reference: wrong
+// dist, a parent arc that is not tight, or a parent chain that cycles.
+static int check_sssp(const CSRGraph *csr, int source, const long long *ref_dist,
+                      const DijkstraResult *d) {
+    int n = csr->n, bad = 0;
+    for (int v = 0; v < n; v++) {
+        if (d->dist[v] != ref_dist[v]) { bad++; continue; }
+        int p = d->parent[v];
+        if (v == source || d->dist[v] >= DIJKSTRA_INF) { bad += p != -1; continue; }
+        int tight = 0;
+        if (p >= 0)
+            for (int k = csr->offsets[p]; k < csr->offsets[p + 1] && !tight; k++)
+                tight = csr->targets[k] == v && d->dist[p] + csr->weights[k] == d->dist[v];
+        bad += !tight;
+    }
 
-            fprintf(stderr, "[progress] Dijkstra Pairing (sparse)\n"); fflush(stderr);
-            run_case("Dijkstra", "Pairing", gs, &pairing_pq_ops, 0);
+    // 0 unvisited, 1 on the current parent walk, 2 known to reach a root
+    char *state = (char *)calloc((size_t)n, 1);
+    for (int v = 0; v < n; v++) {
+        int x = v;
+        while (x >= 0 && state[x] == 0) { state[x] = 1; x = d->parent[x]; }
+        if (x >= 0 && state[x] == 1) bad++; // walked back into this chain
+        for (x = v; x >= 0 && state[x] == 1; x = d->parent[x]) state[x] = 2;
+    }
+    free(state);
+    return bad;
+}
 
-            fprintf(stderr, "[progress] Prim Binary (sparse)\n"); fflush(stderr);
-            run_case("Prim", "Binary", gs, &BINHEAP_OPS, 0);
+// Delta-stepping scaling curve: wall time per thread count vs sequential Dijkstra.
+static void run_scaling(int n, int m) {
+    fprintf(stderr, "\n[progress] building SCALING graph n=%d m=%d\n", n, m);
+    Graph *g = make_random_graph(n, m, 1);
+    CSRGraph *csr = csr_from_graph(g);
+    // Same graph with about a third of the weights zero (ties and 0-cycles)
+    CSRGraph *zcsr = csr_from_graph(g);
+    for (int k = 0; k < zcsr->m; k++) zcsr->weights[k] %= 3;
 
-            fprintf(stderr, "[progress] Prim Fibonacci (sparse)\n"); fflush(stderr);
-            run_case("Prim", "Fibonacci", gs, &fibheap_pq_ops, 0);
+    uint64_t t0 = now_ns();
+    DijkstraResult base = dijkstra_run_csr(csr, 0, &BINHEAP_OPS);
+    uint64_t seq_ns = now_ns() - t0;
+    DijkstraResult zbase = dijkstra_run_csr(zcsr, 0, &BINHEAP_OPS);
+    fprintf(stderr, "[scaling] n=%d sequential Dijkstra (Binary, csr): %" PRIu64 "ns\n", n, seq_ns);
 
-            fprintf(stderr, "[progress] Prim Pairing (sparse)\n"); fflush(stderr);
-            run_case("Prim", "Pairing", gs, &pairing_pq_ops, 0);
+    int max_threads = cpu_count();
+    uint64_t one_ns = 0;
+    for (int th = 1; ; th *= 2) {
+        if (th > max_threads) th = max_threads;
 
-            fprintf(stderr, "[progress] destroying SPARSE graph\n"); fflush(stderr);
-            graph_destroy(gs);
+        DeltaSteppingConfig cfg;
+        delta_stepping_default_config(&cfg);
+        cfg.num_threads = th;
+        cfg.min_parallel_n = 0;
 
-            // ======================
-            // Medium-dense graph runs
-            // ======================
-            fprintf(stderr, "\n[progress] building DENSE graph n=%d m=%d trial=%d\n", n, m_dense, t);
-            fflush(stderr);
-            Graph *gd = make_random_graph(n, m_dense, 1);
+        t0 = now_ns();
+        DijkstraResult d = delta_stepping_run(csr, 0, &cfg);
+        uint64_t ns = now_ns() - t0;
+        int bad = check_sssp(csr, 0, base.dist, &d);
+        dijkstra_free(d);
+        d = delta_stepping_run(zcsr, 0, &cfg);
+        bad += check_sssp(zcsr, 0, zbase.dist, &d);
+        dijkstra_free(d);
+        if (th == 1) one_ns = ns;
+
+        fprintf(stderr, "[scaling] n=%d threads=%d: %" PRIu64 "ns  vs 1 thread %.2fx  vs Dijkstra %.2fx%s\n",
+                n, th, ns, ns ? (double)one_ns / (double)ns : 0.0,
+                ns ? (double)seq_ns / (double)ns : 0.0, bad ? "  MISMATCH" : "");
+        if (th == max_threads) break;
+    }
+
+    dijkstra_free(base);
+    dijkstra_free(zbase);
+    csr_destroy(zcsr);
+    csr_destroy(csr);
+    graph_destroy(g);
+}
+
+// MultiQueue label-correcting SSSP vs thread count: throughput (expansions per
+// second) and wasted work (re-expansions and stale pops) against sequential
+// Dijkstra, which expands each reached vertex exactly once.
+static void run_multiqueue(int n, int m) {
+    fprintf(stderr, "\n[progress] building MULTIQUEUE graph n=%d m=%d\n", n, m);
+    Graph *g = make_random_graph(n, m, 1);
+    CSRGraph *csr = csr_from_graph(g);
+    CSRGraph *zcsr = csr_from_graph(g); // zero-weight variant, as in run_scaling
+    for (int k = 0; k < zcsr->m; k++) zcsr->weights[k] %= 3;
+
+    uint64_t t0 = now_ns();
+    DijkstraResult ref = dijkstra_run_csr(csr, 0, &BINHEAP_OPS);
+    uint64_t seq_ns = now_ns() - t0;
+    DijkstraResult zref = dijkstra_run_csr(zcsr, 0, &BINHEAP_OPS);
+    fprintf(stderr, "[mq] n=%d sequential Dijkstra (Binary, csr): %.2fms\n", n, seq_ns / 1e6);
+
+    int max_threads = cpu_count();
+    for (int th = 1; ; th *= 2) {
+        if (th > max_threads) th = max_threads;
+        MQSSSPConfig cfg;
+        mq_sssp_default_config(&cfg);
+        cfg.num_threads = th;
+        MQSSSPStats s;
+
+        t0 = now_ns();
+        DijkstraResult d = mq_sssp_run(csr, 0, &cfg, &s);
+        uint64_t ns = now_ns() - t0;
+        int mismatches = check_sssp(csr, 0, ref.dist, &d);
+        dijkstra_free(d);
+        d = mq_sssp_run(zcsr, 0, &cfg, NULL);
+        mismatches += check_sssp(zcsr, 0, zref.dist, &d);
+        dijkstra_free(d);
+
+        fprintf(stderr, "[mq] n=%d threads=%d queues=%d: %.2fms (vs Dijkstra %.2fx) %.2fM expansions/s, "
+                        "re-expanded %.1f%%, stale pops %.1f%%%s\n",
+                n, th, th * cfg.queues_per_thread, ns / 1e6, ns ? (double)seq_ns / (double)ns : 0.0,
+                ns ? s.expansions * 1e3 / (double)ns : 0.0,
+                s.reached ? 100.0 * (double)(s.expansions - s.reached) / (double)s.reached : 0.0,
+                s.pops ? 100.0 * (double)s.stale_pops / (double)s.pops : 0.0,
+                mismatches ? "  MISMATCH" : "");
+        if (th == max_threads) break;
+    }
+
+    dijkstra_free(ref);
+    dijkstra_free(zref);
+    csr_destroy(zcsr);
+    csr_destroy(csr);
+    graph_destroy(g);
+}
 
-            fprintf(stderr, "[progress] Dijkstra Binary (dense)\n"); fflush(stderr);
-            run_case("Dijkstra", "Binary", gd, &BINHEAP_OPS, 0);
+// Median wall time in ms of `reps` calls of one lazy/decrease-key variant
+typedef enum { VARIANT_DIJKSTRA, VARIANT_DIJKSTRA_LAZY, VARIANT_PRIM, VARIANT_PRIM_LAZY } Variant;
 
-            fprintf(stderr, "[progress] Dijkstra Fibonacci (dense)\n"); fflush(stderr);
-            run_case("Dijkstra", "Fibonacci", gd, &fibheap_pq_ops, 0);
+static double time_variant(Variant var, const CSRGraph *csr, const PQOps *ops, int reps,
+                           long long *check) {
+    double *t = (double *)malloc(sizeof(double) * (size_t)reps);
+    for (int r = 0; r < reps; r++) {
+        uint64_t t0 = now_ns();
+        if (var == VARIANT_DIJKSTRA || var == VARIANT_DIJKSTRA_LAZY) {
+            DijkstraResult d = var == VARIANT_DIJKSTRA ? dijkstra_run_csr(csr, 0, ops)
+                                                       : dijkstra_run_lazy_csr(csr, 0, ops);
+            t[r] = (double)(now_ns() - t0) / 1e6;
+            *check = 0;
+            for (int v = 0; v < csr->n; v++) if (d.dist[v] < LLONG_MAX / 4) *check += d.dist[v];
+            dijkstra_free(d);
+        } else {
+            PrimResult p = var == VARIANT_PRIM ? prim_run_csr(csr, 0, ops) : prim_run_lazy_csr(csr, 0, ops);
+            t[r] = (double)(now_ns() - t0) / 1e6;
+            *check = p.mst_weight;
+            prim_free(p);
+        }
+    }
+    double ms = sample_stats(t, reps).median;
+    free(t);
+    return ms;
+}
+
+// Lazy insertion (no decrease-key) vs the decrease-key path, per backend and
+// average degree; "Compact" is the handle-free insert-only heap (ops NULL).
+static void run_lazy_compare(int n, int reps) {
+    const int degrees[] = { 2, 8, 32 };
+    for (int di = 0; di < 3; di++) {
+        int m = degrees[di] * n;
+        fprintf(stderr, "\n[progress] building LAZY graphs n=%d m=%d\n", n, m);
+        Graph *dg = make_random_graph(n, m, 1);
+        Graph *ug = make_random_graph(n, m / 2, 0);
+        CSRGraph *dcsr = csr_from_graph(dg);
+        CSRGraph *ucsr = csr_from_graph(ug);
+
+        long long dref, pref, got;
+        time_variant(VARIANT_DIJKSTRA, dcsr, &BINHEAP_OPS, 1, &dref);
+        time_variant(VARIANT_PRIM, ucsr, &BINHEAP_OPS, 1, &pref);
+
+        double lazy_ms = time_variant(VARIANT_DIJKSTRA_LAZY, dcsr, NULL, reps, &got);
+        int bad = got != dref;
+        double prim_ms = time_variant(VARIANT_PRIM_LAZY, ucsr, NULL, reps, &got);
+        bad |= got != pref;
+        fprintf(stderr, "[lazy] n=%d deg=%d %-9s Dijkstra lazy %8.2fms | Prim lazy %8.2fms%s\n",
+                n, degrees[di], "Compact", lazy_ms, prim_ms, bad ? "  MISMATCH" : "");
+
+        for (int h = 0; h < NUM_HEAPS; h++) {
+            const PQOps *ops = HEAPS[h].ops;
+            double dk_ms = time_variant(VARIANT_DIJKSTRA, dcsr, ops, reps, &got);
+            bad = got != dref;
+            lazy_ms = time_variant(VARIANT_DIJKSTRA_LAZY, dcsr, ops, reps, &got);
+            bad |= got != dref;
+            fprintf(stderr, "[lazy] n=%d deg=%d %-9s Dijkstra dec-key %8.2fms lazy %8.2fms (%.2fx)",
+                    n, degrees[di], HEAPS[h].name, dk_ms, lazy_ms, lazy_ms > 0 ? dk_ms / lazy_ms : 0.0);
+            if (!HEAPS[h].monotone_only) {
+                double pk_ms = time_variant(VARIANT_PRIM, ucsr, ops, reps, &got);
+                bad |= got != pref;
+                prim_ms = time_variant(VARIANT_PRIM_LAZY, ucsr, ops, reps, &got);
+                bad |= got != pref;
+                fprintf(stderr, " | Prim dec-key %8.2fms lazy %8.2fms (%.2fx)",
+                        pk_ms, prim_ms, prim_ms > 0 ? pk_ms / prim_ms : 0.0);
+            }
+            fprintf(stderr, "%s\n", bad ? "  MISMATCH" : "");
+        }
+
+        csr_destroy(dcsr);
+        csr_destroy(ucsr);
+        graph_destroy(dg);
+        graph_destroy(ug);
+    }
+}
+
+// Incremental SSSP: latency of repairing a shortest-path tree after a batch of
+// edge insertions / weight decreases vs. recomputing from scratch, per batch
+// size; the repaired tree is checked against a full recomputation.
+static void run_dynamic_sssp(int n, int m, int batches) {
+    const int sizes[] = { 1, 10, 100, 1000, 10000 };
+    const char *heaps[] = { "Binary", "Dary4", "Radix" };
+    for (int hi = 0; hi < 3; hi++) {
+        const HeapEntry *h = find_heap(heaps[hi]);
+        fprintf(stderr, "\n[progress] building DYNAMIC graph n=%d m=%d (%s)\n", n, m, h->name);
+        Graph *g = make_random_graph(n, m, 1);
+
+        uint64_t t0 = now_ns();
+        DijkstraResult r = dijkstra_run(g, 0, h->ops);
+        uint64_t full_ns = now_ns() - t0;
+        DynSSSP *dyn = dyn_sssp_create(g, &r, h->ops);
+        EdgeUpdate *up = (EdgeUpdate *)malloc(sizeof(EdgeUpdate) * 10000);
+
+        for (int si = 0; si < 5; si++) {
+            int count = sizes[si];
+            uint64_t ns = 0;
+            long long improvements = 0;
+            for (int b = 0; b < batches; b++) {
+                // Half new links, half existing arcs made cheaper
+                for (int i = 0; i < count; i++) {
+                    int u = rand_int(0, n - 1);
+                    if (i % 2 == 0 || !g->adj[u]) {
+                        up[i].u = u;
+                        up[i].v = rand_int(0, n - 1);
+                        up[i].w = rand_int(1, 20);
+                    } else {
+                        up[i].u = u;
+                        up[i].v = g->adj[u]->to;
+                        up[i].w = g->adj[u]->w / 2;
+                    }
+                }
+                DynSSSPStats st;
+                t0 = now_ns();
+                dyn_sssp_update(dyn, up, count, &st);
+                ns += now_ns() - t0;
+                improvements += st.improvements;
+            }
+
+            DijkstraResult ref = dijkstra_run(g, 0, &BINHEAP_OPS);
+            int mismatches = 0;
+            for (int v = 0; v < n; v++) mismatches += r.dist[v] != ref.dist[v];
+            dijkstra_free(ref);
+
+            double batch_us = ns / 1e3 / batches;
+            fprintf(stderr, "[dyn] n=%d %s batch=%d: %.1fus/batch %.2fus/update, %.0f improved/batch, "
+                            "full recompute %.1fus (%.1fx)%s\n",
+                    n, h->name, count, batch_us, batch_us / count, (double)improvements / batches,
+                    full_ns / 1e3, batch_us > 0 ? full_ns / 1e3 / batch_us : 0.0,
+                    mismatches ? "  MISMATCH" : "");
+        }
+
+        free(up);
+        dyn_sssp_destroy(dyn);
+        dijkstra_free(r);
+        graph_destroy(g);
+    }
+}
+
+// Incremental MST (link-cut trees) vs recomputing Prim after every batch of
+// inserted edges, on a connected undirected grid
+static void run_dynamic_mst(int side, int batch, int batches) {
+    int n = side * side;
+    fprintf(stderr, "\n[progress] building DYNMST grid n=%d\n", n);
+    Graph *g = graph_generate(GEN_GRID, n, 0, 0, rng_u32());
+
+    uint64_t t0 = now_ns();
+    PrimResult r = prim_run(g, 0, &BINHEAP_OPS);
+    uint64_t build_ns = now_ns() - t0;
+    t0 = now_ns();
+    DynMST *dyn = dyn_mst_create(g, &r);
+    uint64_t create_ns = now_ns() - t0;
+    prim_free(r);
+
+    uint64_t ins_ns = 0, full_ns = 0;
+    long long changed = 0;
+    int mismatches = 0;
+    for (int b = 0; b < batches; b++) {
+        for (int i = 0; i < batch; i++) {
+            int u = rand_int(0, n - 1), v = rand_int(0, n - 1), w = rand_int(1, 20);
+            t0 = now_ns();
+            changed += dyn_mst_insert(dyn, u, v, w);
+            ins_ns += now_ns() - t0;
+            if (u != v) graph_add_edge(g, u, v, w);
+        }
+        t0 = now_ns();
+        PrimResult ref = prim_run(g, 0, &BINHEAP_OPS);
+        full_ns += now_ns() - t0;
+        mismatches += ref.mst_weight != dyn_mst_weight(dyn);
+        prim_free(ref);
+    }
+
+    t0 = now_ns();
+    PrimResult cur = dyn_mst_result(dyn, 0);
+    uint64_t export_ns = now_ns() - t0;
+    prim_free(cur);
+
+    double per_insert_us = ins_ns / 1e3 / ((double)batch * batches);
+    double full_us = full_ns / 1e3 / batches;
+    fprintf(stderr, "[dynmst] n=%d initial Prim %.1fms, create %.1fms, parent export %.1fms\n",
+            n, build_ns / 1e6, create_ns / 1e6, export_ns / 1e6);
+    fprintf(stderr, "[dynmst] n=%d %d inserts: %.2fus/insert, %.1f%% changed the tree, "
+                    "Prim recompute %.1fus (%.0fx one insert)%s\n",
+            n, batch * batches, per_insert_us, 100.0 * changed / ((double)batch * batches),
+            full_us, per_insert_us > 0 ? full_us / per_insert_us : 0.0,
+            mismatches ? "  MISMATCH" : "");
+
+    dyn_mst_destroy(dyn);
+    graph_destroy(g);
+}
+
+// Parallel Borůvka vs heap-based Prim (Binary/Fibonacci/Pairing) on an undirected graph.
+static void run_mst_compare(int n, int m) {
+    fprintf(stderr, "\n[progress] building MST graph n=%d m=%d (undirected)\n", n, m);
+    Graph *g = make_random_graph(n, m, 0);
+    CSRGraph *csr = csr_from_graph(g);
 
-            fprintf(stderr, "[progress] Dijkstra Pairing (dense)\n"); fflush(stderr);
-            run_case("Dijkstra", "Pairing", gd, &pairing_pq_ops, 0);
+    const char *heaps[] = { "Binary", "Fibonacci", "Pairing" };
+    long long ref_weight = -1;
+    for (int hi = 0; hi < 3; hi++) {
+        const HeapEntry *h = find_heap(heaps[hi]);
+        uint64_t t0 = now_ns();
+        PrimResult p = prim_run_csr(csr, 0, h->ops);
+        uint64_t ns = now_ns() - t0;
+        ref_weight = p.mst_weight;
+        fprintf(stderr, "[mst] n=%d Prim %s: %" PRIu64 "ns weight=%lld\n", n, h->name, ns, p.mst_weight);
+        prim_free(p);
+    }
 
-            fprintf(stderr, "[progress] Prim Binary (dense)\n"); fflush(stderr);
-            run_case("Prim", "Binary", gd, &BINHEAP_OPS, 0);
+    int max_threads = cpu_count();
+    for (int th = 1; ; th *= 2) {
+        if (th > max_threads) th = max_threads;
+        uint64_t t0 = now_ns();
+        PrimResult p = boruvka_mst_run(csr, 0, th);
+        uint64_t ns = now_ns() - t0;
+        fprintf(stderr, "[mst] n=%d Boruvka threads=%d: %" PRIu64 "ns weight=%lld%s\n", n, th, ns,
+                p.mst_weight, p.mst_weight == ref_weight ? "" : "  MISMATCH");
+        prim_free(p);
+        if (th == max_threads) break;
+    }
 
-            fprintf(stderr, "[progress] Prim Fibonacci (dense)\n"); fflush(stderr);
-            run_case("Prim", "Fibonacci", gd, &fibheap_pq_ops, 0);
+    csr_destroy(csr);
+    graph_destroy(g);
+}
 
-            fprintf(stderr, "[progress] Prim Pairing (dense)\n"); fflush(stderr);
-            run_case("Prim", "Pairing", gd, &pairing_pq_ops, 0);
+// Heap Prim vs the O(n^2) array-scan Prim (adjacency lists and matrix) over
+// densities up to the complete graph; ratios are against the Binary heap.
+typedef enum { DENSE_HEAP, DENSE_LIST, DENSE_MATRIX } DenseMode;
 
-            fprintf(stderr, "[progress] destroying DENSE graph\n"); fflush(stderr);
-            graph_destroy(gd);
+static double time_dense(DenseMode mode, const Graph *g, const int *w, const PQOps *ops,
+                         int reps, long long *check) {
+    double *t = (double *)malloc(sizeof(double) * (size_t)reps);
+    for (int r = 0; r < reps; r++) {
+        uint64_t t0 = now_ns();
+        PrimResult p = mode == DENSE_HEAP   ? prim_run_heap(g, 0, ops)
+                     : mode == DENSE_LIST   ? prim_run_dense(g, 0)
+                                            : prim_run_matrix(w, g->n, 0);
+        t[r] = (double)(now_ns() - t0) / 1e6;
+        *check = p.mst_weight;
+        prim_free(p);
+    }
+    double ms = sample_stats(t, reps).median;
+    free(t);
+    return ms;
+}
+
+static void run_dense_prim(int n, int reps) {
+    const int divisors[] = { 256, 64, 32, 16, 8, 2 }; // undirected edges m = n*n / d
+    const char *heaps[] = { "Binary", "Pairing", "Dary4" };
+    int *w = (int *)malloc(sizeof(int) * (size_t)n * (size_t)n);
+    fprintf(stderr, "\n[progress] DENSE Prim n=%d (min-scan kernel: %s)\n", n, min_scan_isa());
+
+    for (int di = 0; di < 6; di++) {
+        int m = (int)((long long)n * n / divisors[di]);
+        Graph *g = make_random_graph(n, m, 0);
+        for (long long i = 0; i < (long long)n * n; i++) w[i] = PRIM_NO_EDGE;
+        for (int u = 0; u < n; u++)
+            for (Edge *e = g->adj[u]; e; e = e->next)
+                if (e->w < w[(size_t)u * n + e->to]) w[(size_t)u * n + e->to] = e->w;
+
+        long long ref, got;
+        double binary_ms = 0;
+        int bad = 0;
+        fprintf(stderr, "[dense] n=%d m=n*n/%d", n, divisors[di]);
+        for (int hi = 0; hi < 3; hi++) {
+            const HeapEntry *h = find_heap(heaps[hi]);
+            double ms = time_dense(DENSE_HEAP, g, w, h->ops, reps, &got);
+            if (hi == 0) { ref = got; binary_ms = ms; }
+            bad |= got != ref;
+            fprintf(stderr, " %s %.2fms", h->name, ms);
         }
+        double list_ms = time_dense(DENSE_LIST, g, w, NULL, reps, &got);
+        bad |= got != ref;
+        double matrix_ms = time_dense(DENSE_MATRIX, g, w, NULL, reps, &got);
+        bad |= got != ref;
+        fprintf(stderr, " | dense list %.2fms (%.2fx) matrix %.2fms (%.2fx)%s\n",
+                list_ms, list_ms > 0 ? binary_ms / list_ms : 0.0,
+                matrix_ms, matrix_ms > 0 ? binary_ms / matrix_ms : 0.0, bad ? "  MISMATCH" : "");
+        graph_destroy(g);
     }
+    free(w);
+}
+
+typedef struct {
+    const Graph *g;
+    long long *sums; // per query: sum of finite distances
+} SumCtx;
+
+static void sum_dist_cb(void *user, int query, int source,
+                        const long long *dist, const int *parent) {
+    (void)source; (void)parent;
+    SumCtx *ctx = (SumCtx *)user;
+    long long s = 0;
+    for (int i = 0; i < ctx->g->n; i++) if (dist[i] < LLONG_MAX / 4) s += dist[i];
+    ctx->sums[query] = s;
+}
+
+// Queries whose distance sum differs from the sequential reference; sums are
+// poisoned afterwards so a query the next run skips cannot pass on stale data
+static int count_sum_mismatches(long long *sums, const long long *ref, int queries) {
+    int bad = 0;
+    for (int q = 0; q < queries; q++) {
+        if (sums[q] != ref[q]) bad++;
+        sums[q] = -1;
+    }
+    return bad;
+}
+
+// Batched multi-source executor: throughput and latency percentiles per heap,
+// plain and profiled runs interleaved `reps` times and reported as medians.
+static void run_query_batch(const TscClock *clk, int n, int m, int queries, int reps) {
+    fprintf(stderr, "\n[progress] building QUERY graph n=%d m=%d\n", n, m);
+    Graph *g = make_random_graph(n, m, 1);
+    int *sources = (int *)malloc(sizeof(int) * (size_t)queries);
+    SumCtx ctx = { g, (long long *)malloc(sizeof(long long) * (size_t)queries) };
+    for (int q = 0; q < queries; q++) sources[q] = rand_int(0, n - 1);
+
+    // Sequential reference sum for every query
+    long long *ref_sums = (long long *)malloc(sizeof(long long) * (size_t)queries);
+    for (int q = 0; q < queries; q++) {
+        DijkstraResult ref = dijkstra_run(g, sources[q], &BINHEAP_OPS);
+        sum_dist_cb(&ctx, q, sources[q], ref.dist, ref.parent);
+        ref_sums[q] = ctx.sums[q];
+        ctx.sums[q] = -1;
+        dijkstra_free(ref);
+    }
+
+    double *qps = (double *)malloc(sizeof(double) * (size_t)reps);
+    double *pqps = (double *)malloc(sizeof(double) * (size_t)reps);
+    double *p50 = (double *)malloc(sizeof(double) * (size_t)reps);
+    double *p99 = (double *)malloc(sizeof(double) * (size_t)reps);
+    const char *heaps[] = { "Binary", "Dary4", "Radix" };
+    for (int hi = 0; hi < 3; hi++) {
+        const HeapEntry *h = find_heap(heaps[hi]);
+        QueryExecutor *ex = query_exec_create(g, h->ops, cpu_count());
+        query_exec_run(ex, sources, queries < 8 ? queries : 8, NULL, NULL); // warm the workspaces
+
+        // Same batch with one profile per worker (sampled TSC timing), merged after
+        int T = cpu_count();
+        PQProfile *prof = (PQProfile *)malloc(sizeof(PQProfile) * (size_t)T);
+        const PQOps **ops = (const PQOps **)malloc(sizeof(PQOps *) * (size_t)T);
+        for (int t = 0; t < T; t++) {
+            ops[t] = pq_profile_ops(h->ops, &prof[t]);
+            pq_profile_reset(&prof[t]);
+            pq_profile_set_timing(&prof[t], clk, 16);
+        }
+        QueryExecutor *pex = query_exec_create_per_thread(g, ops, T);
+        query_exec_run(pex, sources, queries < 8 ? queries : 8, NULL, NULL);
+
+        // Alternate the modes so drift during the run hits both alike
+        int bad = 0, pbad = 0;
+        for (int r = 0; r < reps; r++) {
+            QueryBatchStats st = query_exec_run(ex, sources, queries, sum_dist_cb, &ctx);
+            bad += count_sum_mismatches(ctx.sums, ref_sums, queries);
+            qps[r] = st.qps;
+            p50[r] = st.p50_us;
+            p99[r] = st.p99_us;
+
+            for (int t = 0; t < T; t++) {
+                pq_profile_reset(&prof[t]);
+                pq_profile_set_timing(&prof[t], clk, 16);
+            }
+            QueryBatchStats pst = query_exec_run(pex, sources, queries, sum_dist_cb, &ctx);
+            pbad += count_sum_mismatches(ctx.sums, ref_sums, queries);
+            pqps[r] = pst.qps;
+        }
+        query_exec_destroy(ex);
+        query_exec_destroy(pex);
+
+        double base = sample_stats(qps, reps).median;
+        double prof_qps = sample_stats(pqps, reps).median;
+        fprintf(stderr, "[query] n=%d %s threads=%d: %d queries %.1f q/s p50=%.1fus p99=%.1fus%s\n",
+                n, h->name, T, queries, base, sample_stats(p50, reps).median,
+                sample_stats(p99, reps).median, bad ? "  MISMATCH" : "");
+
+        // Per-operation numbers come from the last profiled run
+        PQProfile total;
+        memset(&total, 0, sizeof(total));
+        for (int t = 0; t < T; t++) pq_profile_merge(&total, &prof[t]);
+        fprintf(stderr, "[query] n=%d %s threads=%d profiled: %.1f q/s (overhead %.1f%%, median of %d) "
+                        "mean ns insert %.0f extract %.0f decrease %.0f, extract p99 %.0fns%s\n",
+                n, h->name, T, prof_qps, 100.0 * (base - prof_qps) / base, reps,
+                total.insert_count ? (double)total.insert_ns / total.insert_count : 0.0,
+                total.extract_count ? (double)total.extract_ns / total.extract_count : 0.0,
+                total.decrease_count ? (double)total.decrease_ns / total.decrease_count : 0.0,
+                latency_hist_quantile(&total.hist[PQ_OP_EXTRACT], 0.99),
+                pbad ? "  MISMATCH" : "");
+        free(ops);
+        free(prof);
+    }
+
+    free(qps);
+    free(pqps);
+    free(p50);
+    free(p99);
+    free(sources);
+    free(ctx.sums);
+    free(ref_sums);
+    graph_destroy(g);
+}
+
+// Random s-t pairs: full Dijkstra vs early-exit vs bidirectional, per heap.
+static void run_st_queries(int n, int m, int pairs) {
+    fprintf(stderr, "\n[progress] building S-T graph n=%d m=%d\n", n, m);
+    Graph *g = make_random_graph(n, m, 1);
+    Graph *rev = graph_reverse(g);
+    int *src = (int *)malloc(sizeof(int) * (size_t)pairs);
+    int *dst = (int *)malloc(sizeof(int) * (size_t)pairs);
+    for (int i = 0; i < pairs; i++) { src[i] = rand_int(0, n - 1); dst[i] = rand_int(0, n - 1); }
+
+    const char *heaps[] = { "Binary", "Dary4", "Radix" };
+    for (int hi = 0; hi < 3; hi++) {
+        const HeapEntry *h = find_heap(heaps[hi]);
+        uint64_t full_ns = 0, st_ns = 0, bi_ns = 0;
+        long long st_settled = 0, bi_settled = 0;
+        int mismatches = 0;
+
+        for (int i = 0; i < pairs; i++) {
+            uint64_t t0 = now_ns();
+            DijkstraResult d = dijkstra_run(g, src[i], h->ops);
+            uint64_t t1 = now_ns();
+            STResult a = dijkstra_st(g, src[i], dst[i], h->ops);
+            uint64_t t2 = now_ns();
+            STResult b = bidijkstra_st(g, rev, src[i], dst[i], h->ops);
+            uint64_t t3 = now_ns();
+
+            full_ns += t1 - t0; st_ns += t2 - t1; bi_ns += t3 - t2;
+            st_settled += a.settled; bi_settled += b.settled;
+            if (a.dist != d.dist[dst[i]] || b.dist != d.dist[dst[i]]) mismatches++;
+            dijkstra_free(d);
+        }
+
+        fprintf(stderr, "[st] n=%d %s: full=%.1fus  early-exit=%.1fus (settled %lld)  "
+                        "bidirectional=%.1fus (settled %lld)%s\n",
+                n, h->name, full_ns / 1e3 / pairs, st_ns / 1e3 / pairs, st_settled / pairs,
+                bi_ns / 1e3 / pairs, bi_settled / pairs, mismatches ? "  MISMATCH" : "");
+    }
+
+    free(src);
+    free(dst);
+    graph_destroy(rev);
+    graph_destroy(g);
+}
+
+// Bounded-radius queries: a reused SearchContext vs a fresh O(n) setup per query.
+static void run_bounded_queries(long long radius, int queries) {
+    const int sizes[] = { 10000, 100000, 1000000 };
+    for (int si = 0; si < 3; si++) {
+        int n = sizes[si];
+        fprintf(stderr, "\n[progress] building BOUNDED graph n=%d m=%d\n", n, 4 * n);
+        Graph *g = make_random_graph(n, 4 * n, 1);
+
+        const char *heaps[] = { "Dary4", "Radix" };
+        for (int hi = 0; hi < 2; hi++) {
+            const HeapEntry *h = find_heap(heaps[hi]);
+            SearchContext *ctx = search_ctx_create(n, h->ops);
+            long long touched = 0;
+
+            uint64_t t0 = now_ns();
+            for (int q = 0; q < queries; q++) {
+                search_ctx_run(ctx, g, rand_int(0, n - 1), -1, radius);
+                touched += ctx->touched;
+            }
+            uint64_t reuse_ns = now_ns() - t0;
+            search_ctx_destroy(ctx);
+
+            int fresh_queries = queries / 10 > 0 ? queries / 10 : 1;
+            t0 = now_ns();
+            for (int q = 0; q < fresh_queries; q++) {
+                SearchContext *fresh = search_ctx_create(n, h->ops);
+                search_ctx_run(fresh, g, rand_int(0, n - 1), -1, radius);
+                search_ctx_destroy(fresh);
+            }
+            uint64_t fresh_ns = now_ns() - t0;
+
+            fprintf(stderr, "[bounded] n=%d %s radius=%lld: reused=%.2fus/query (touched %lld)  fresh=%.2fus/query\n",
+                    n, h->name, radius, reuse_ns / 1e3 / queries, touched / queries,
+                    fresh_ns / 1e3 / fresh_queries);
+        }
+        graph_destroy(g);
+    }
+}
+
+// A* with ALT landmarks vs plain early-exit Dijkstra on the same reused context.
+static void run_alt_queries(int n, int m, int landmarks, int pairs) {
+    fprintf(stderr, "\n[progress] building ALT graph n=%d m=%d\n", n, m);
+    Graph *g = make_random_graph(n, m, 1);
+    Graph *rev = graph_reverse(g);
+
+    uint64_t t0 = now_ns();
+    ALTData *alt = alt_build(g, rev, landmarks, &DARY4_OPS);
+    uint64_t build_ns = now_ns() - t0;
+    fprintf(stderr, "[alt] n=%d landmarks=%d preprocess=%.1fms table=%.1fMB\n",
+            n, landmarks, build_ns / 1e6, 2.0 * n * landmarks * sizeof(long long) / 1e6);
+
+    int *src = (int *)malloc(sizeof(int) * (size_t)pairs);
+    int *dst = (int *)malloc(sizeof(int) * (size_t)pairs);
+    for (int i = 0; i < pairs; i++) { src[i] = rand_int(0, n - 1); dst[i] = rand_int(0, n - 1); }
+
+    const char *heaps[] = { "Dary4", "Radix" };
+    for (int hi = 0; hi < 2; hi++) {
+        const HeapEntry *h = find_heap(heaps[hi]);
+        SearchContext *ctx = search_ctx_create(n, h->ops);
+        uint64_t dij_ns = 0, alt_ns = 0;
+        long long dij_settled = 0, alt_settled = 0;
+        int mismatches = 0;
+
+        for (int i = 0; i < pairs; i++) {
+            t0 = now_ns();
+            long long d = search_ctx_run(ctx, g, src[i], dst[i], DIJKSTRA_INF);
+            uint64_t t1 = now_ns();
+            dij_settled += ctx->settled;
+            STResult a = alt_query(ctx, g, alt, src[i], dst[i]);
+            uint64_t t2 = now_ns();
+            alt_settled += a.settled;
+            dij_ns += t1 - t0; alt_ns += t2 - t1;
+            if (a.dist != d) mismatches++;
+        }
+
+        fprintf(stderr, "[alt] n=%d %s: dijkstra=%.1fus (settled %lld)  alt=%.1fus (settled %lld)%s\n",
+                n, h->name, dij_ns / 1e3 / pairs, dij_settled / pairs,
+                alt_ns / 1e3 / pairs, alt_settled / pairs, mismatches ? "  MISMATCH" : "");
+        search_ctx_destroy(ctx);
+    }
+
+    free(src);
+    free(dst);
+    alt_destroy(alt);
+    graph_destroy(rev);
+    graph_destroy(g);
+}
+
+// Contraction hierarchies vs bidirectional Dijkstra on a grid.
+static void run_ch_queries(int side, int pairs) {
+    int n = side * side;
+    fprintf(stderr, "\n[progress] building CH grid %dx%d\n", side, side);
+    Graph *g = make_grid_graph(side);
+    Graph *rev = graph_reverse(g);
+
+    int *src = (int *)malloc(sizeof(int) * (size_t)pairs);
+    int *dst = (int *)malloc(sizeof(int) * (size_t)pairs);
+    for (int i = 0; i < pairs; i++) { src[i] = rand_int(0, n - 1); dst[i] = rand_int(0, n - 1); }
+
+    const char *heaps[] = { "Dary4", "Radix" };
+    for (int hi = 0; hi < 2; hi++) {
+        const HeapEntry *h = find_heap(heaps[hi]);
+        uint64_t t0 = now_ns();
+        CHGraph *ch = ch_build(g, h->ops);
+        uint64_t build_ns = now_ns() - t0;
+
+        SearchContext *fwd = search_ctx_create(n, h->ops);
+        SearchContext *bwd = search_ctx_create(n, h->ops);
+        uint64_t bi_ns = 0, ch_ns = 0;
+        long long bi_settled = 0, ch_settled = 0;
+        int mismatches = 0;
+
+        for (int i = 0; i < pairs; i++) {
+            t0 = now_ns();
+            STResult b = bidijkstra_st(g, rev, src[i], dst[i], h->ops);
+            uint64_t t1 = now_ns();
+            STResult c = ch_query(ch, fwd, bwd, src[i], dst[i]);
+            uint64_t t2 = now_ns();
+            bi_ns += t1 - t0; ch_ns += t2 - t1;
+            bi_settled += b.settled; ch_settled += c.settled;
+            if (b.dist != c.dist) mismatches++;
+        }
+
+        // Spot-check against full single-source runs
+        for (int i = 0; i < pairs && i < 20; i++) {
+            DijkstraResult d = dijkstra_run(g, src[i], h->ops);
+            for (int j = 0; j < pairs; j += pairs / 20 + 1)
+                if (ch_query(ch, fwd, bwd, src[i], dst[j]).dist != d.dist[dst[j]]) mismatches++;
+            dijkstra_free(d);
+        }
+
+        fprintf(stderr, "[ch] n=%d %s: preprocess=%.1fms shortcuts=%lld  bidijkstra=%.1fus (settled %lld)  "
+                        "ch=%.1fus (settled %lld)%s\n",
+                n, h->name, build_ns / 1e6, ch->shortcuts, bi_ns / 1e3 / pairs, bi_settled / pairs,
+                ch_ns / 1e3 / pairs, ch_settled / pairs, mismatches ? "  MISMATCH" : "");
+
+        search_ctx_destroy(fwd);
+        search_ctx_destroy(bwd);
+        ch_destroy(ch);
+    }
+
+    free(src);
+    free(dst);
+    graph_destroy(rev);
+    graph_destroy(g);
+}
+
+// Hub-label distance oracle: label size and lookup latency vs dijkstra_run.
+static void run_hub_labels(int n, int m, int queries) {
+    fprintf(stderr, "\n[progress] building HUB LABEL graph n=%d m=%d\n", n, m);
+    Graph *g = make_random_graph(n, m, 1);
+    Graph *rev = graph_reverse(g);
+
+    const char *heaps[] = { "Dary4", "Radix" };
+    for (int hi = 0; hi < 2; hi++) {
+        const HeapEntry *h = find_heap(heaps[hi]);
+        uint64_t t0 = now_ns();
+        HubLabels *hl = hub_labels_build(g, rev, h->ops);
+        uint64_t build_ns = now_ns() - t0;
+        long long entries = hub_labels_entries(hl);
+        fprintf(stderr, "[hub] n=%d %s: build=%.1fms entries=%lld (%.1f per label) memory=%.1fMB\n",
+                n, h->name, build_ns / 1e6, entries, entries / (2.0 * n), hub_labels_bytes(hl) / 1e6);
+
+        // Each dijkstra_run answers a whole row; the oracle is timed on the same pairs
+        uint64_t dij_ns = 0, hub_ns = 0;
+        int mismatches = 0, rows = queries / 100 > 0 ? queries / 100 : 1;
+        for (int q = 0; q < rows; q++) {
+            int s = rand_int(0, n - 1);
+            t0 = now_ns();
+            DijkstraResult d = dijkstra_run(g, s, h->ops);
+            dij_ns += now_ns() - t0;
+            int targets[100];
+            for (int i = 0; i < 100; i++) targets[i] = rand_int(0, n - 1);
+            t0 = now_ns();
+            for (int i = 0; i < 100; i++) {
+                long long dist = hub_labels_query(hl, s, targets[i]);
+                if (dist != d.dist[targets[i]]) mismatches++;
+            }
+            hub_ns += now_ns() - t0;
+            dijkstra_free(d);
+        }
+
+        fprintf(stderr, "[hub] n=%d %s: dijkstra_run=%.1fus/source  label query=%.3fus%s\n",
+                n, h->name, dij_ns / 1e3 / rows, hub_ns / 1e3 / (rows * 100.0),
+                mismatches ? "  MISMATCH" : "");
+        hub_labels_destroy(hl);
+    }
+
+    graph_destroy(rev);
+    graph_destroy(g);
+}
+
+// Binary graph file: build-from-edges vs zero-copy mmap startup, then the
+// same Dijkstra/Prim runs on the mapped arrays.
+static void run_graph_file(int n, int m) {
+    const char *path = "bench_graph.csrg";
+    fprintf(stderr, "\n[progress] building FILE graph n=%d m=%d (undirected)\n", n, m);
+    uint64_t t0 = now_ns();
+    Graph *g = make_random_graph(n, m, 0);
+    CSRGraph *csr = csr_from_graph(g);
+    uint64_t build_ns = now_ns() - t0;
+
+    if (graph_file_write(csr, path) != 0) {
+        fprintf(stderr, "[file] cannot write %s, skipping\n", path);
+        csr_destroy(csr);
+        graph_destroy(g);
+        return;
+    }
+
+    t0 = now_ns();
+    MappedGraph *mg = graph_file_map(path);
+    uint64_t map_ns = now_ns() - t0;
+    if (!mg) {
+        fprintf(stderr, "[file] cannot map %s, skipping\n", path);
+        remove(path);
+        csr_destroy(csr);
+        graph_destroy(g);
+        return;
+    }
+    fprintf(stderr, "[file] n=%d arcs=%d: build in memory=%.1fms  map=%.3fms  file=%.1fMB\n",
+            n, csr->m, build_ns / 1e6, map_ns / 1e6, mg->file.len / 1e6);
+
+    const char *heaps[] = { "Binary", "Dary4" };
+    for (int hi = 0; hi < 2; hi++) {
+        const HeapEntry *h = find_heap(heaps[hi]);
+        t0 = now_ns();
+        DijkstraResult a = dijkstra_run_csr(csr, 0, h->ops);
+        uint64_t t1 = now_ns();
+        DijkstraResult b = dijkstra_run_csr(&mg->csr, 0, h->ops);
+        uint64_t t2 = now_ns();
+        PrimResult pa = prim_run_csr(csr, 0, h->ops);
+        uint64_t t3 = now_ns();
+        PrimResult pb = prim_run_csr(&mg->csr, 0, h->ops);
+        uint64_t t4 = now_ns();
+
+        int mismatch = pa.mst_weight != pb.mst_weight;
+        for (int v = 0; v < n && !mismatch; v++) mismatch = a.dist[v] != b.dist[v];
+        fprintf(stderr, "[file] n=%d %s: dijkstra heap=%.1fms mapped=%.1fms  prim heap=%.1fms mapped=%.1fms%s\n",
+                n, h->name, (t1 - t0) / 1e6, (t2 - t1) / 1e6, (t3 - t2) / 1e6, (t4 - t3) / 1e6,
+                mismatch ? "  MISMATCH" : "");
+        dijkstra_free(a);
+        dijkstra_free(b);
+        prim_free(pa);
+        prim_free(pb);
+    }
+
+    graph_file_unmap(mg);
+    remove(path);
+    csr_destroy(csr);
+    graph_destroy(g);
+}
+
+// --load <file>: parse throughput (single vs multi-threaded), CSR build,
+// and one Dijkstra run per heap on the loaded graph.
+static int run_load(const char *path) {
+    int threads = cpu_count();
+    EdgeList el;
+    uint64_t t0 = now_ns();
+    if (graph_parse_file(path, 1, &el) != 0) return 1;
+    uint64_t single_ns = now_ns() - t0;
+    edge_list_free(&el);
+
+    t0 = now_ns();
+    if (graph_parse_file(path, threads, &el) != 0) return 1;
+    uint64_t multi_ns = now_ns() - t0;
+    fprintf(stderr, "[load] %s: %.1fMB n=%d edges=%d  1 thread=%.1fMB/s  %d threads=%.1fMB/s\n",
+            path, el.bytes / 1e6, el.n, el.count, el.bytes / 1e6 / (single_ns / 1e9),
+            threads, el.bytes / 1e6 / (multi_ns / 1e9));
+
+    t0 = now_ns();
+    CSRGraph *csr = csr_from_edge_list(&el, 1);
+    fprintf(stderr, "[load] csr build=%.1fms\n", (now_ns() - t0) / 1e6);
+    edge_list_free(&el);
+
+    for (int h = 0; h < NUM_HEAPS; h++) {
+        if (csr->n == 0) break;
+        t0 = now_ns();
+        DijkstraResult d = dijkstra_run_csr(csr, 0, HEAPS[h].ops);
+        uint64_t ns = now_ns() - t0;
+        int reached = 0;
+        for (int v = 0; v < csr->n; v++) reached += d.dist[v] < DIJKSTRA_INF;
+        fprintf(stderr, "[load] dijkstra %s: %.1fms reached=%d\n", HEAPS[h].name, ns / 1e6, reached);
+        dijkstra_free(d);
+    }
+    csr_destroy(csr);
+    return 0;
+}
+
+// Vertex reordering: Dijkstra on the CSR layout of each relabeled graph, per
+// heap, with results translated back and checked against the original ids.
+static void run_reorder(int n, int m, int sources) {
+    fprintf(stderr, "\n[progress] building REORDER graph n=%d m=%d\n", n, m);
+    Graph *g = make_random_graph(n, m, 1);
+    int *src = (int *)malloc(sizeof(int) * (size_t)sources);
+    for (int i = 0; i < sources; i++) src[i] = rand_int(0, n - 1);
+
+    DijkstraResult *ref = (DijkstraResult *)malloc(sizeof(DijkstraResult) * (size_t)sources);
+    for (int i = 0; i < sources; i++) ref[i] = dijkstra_run(g, src[i], &DARY4_OPS);
+
+    const char *names[] = { "original", "bfs", "rcm", "degree" };
+    for (int k = 0; k < 4; k++) {
+        uint64_t t0 = now_ns();
+        Permutation *p = k ? reorder_compute(g, (ReorderKind)(k - 1)) : NULL;
+        Graph *pg = p ? graph_permute(g, p) : g;
+        CSRGraph *csr = csr_from_graph(pg);
+        uint64_t prep_ns = now_ns() - t0;
+
+        for (int h = 0; h < NUM_HEAPS; h++) {
+            uint64_t ns = 0;
+            int mismatches = 0;
+            for (int i = 0; i < sources; i++) {
+                t0 = now_ns();
+                DijkstraResult d = dijkstra_run_csr(csr, p ? p->new_id[src[i]] : src[i], HEAPS[h].ops);
+                ns += now_ns() - t0;
+                if (p) reorder_restore_dijkstra(p, &d);
+                for (int v = 0; v < n; v++) mismatches += d.dist[v] != ref[i].dist[v];
+                dijkstra_free(d);
+            }
+            fprintf(stderr, "[reorder] n=%d %s %s: %.2fms/source (prep %.1fms)%s\n",
+                    n, names[k], HEAPS[h].name, ns / 1e6 / sources, prep_ns / 1e6,
+                    mismatches ? "  MISMATCH" : "");
+        }
+
+        csr_destroy(csr);
+        if (p) {
+            graph_destroy(pg);
+            permutation_destroy(p);
+        }
+    }
+
+    for (int i = 0; i < sources; i++) dijkstra_free(ref[i]);
+    free(ref);
+    free(src);
+    graph_destroy(g);
+}
+
+// Cost of profiling itself: Dijkstra unprofiled vs. wrapped with clock_gettime,
+// calibrated TSC and 1-in-16 sampled TSC timing, with the per-operation mean
+// and tail latencies each mode reports.
+static void run_profile_overhead(const TscClock *clk, int n, int m, int reps) {
+    fprintf(stderr, "\n[progress] building PROFILE graph n=%d m=%d\n", n, m);
+    fprintf(stderr, "[profile] tsc %.3f ns/tick, read %.1f ns (pair %.1f ns subtracted), clock_gettime %.1f ns%s\n",
+            clk->ns_per_tick, clk->read_ns, (double)clk->overhead_ticks * clk->ns_per_tick,
+            clk->clock_read_ns, clk->hardware ? "" : " (no cycle counter: tsc = clock)");
+    Graph *g = make_random_graph(n, m, 1);
+    CSRGraph *csr = csr_from_graph(g);
+    const char *modes[] = { "plain", "clock", "tsc", "tsc/16" };
+    double *t = (double *)malloc(sizeof(double) * (size_t)reps);
+
+    for (int h = 0; h < NUM_HEAPS; h++) {
+        double base_ms = 0;
+        for (int k = 0; k < 4; k++) {
+            PQProfile prof;
+            for (int r = 0; r < reps; r++) {
+                const PQOps *ops = HEAPS[h].ops;
+                if (k > 0) {
+                    pq_profile_reset(&prof);
+                    pq_profile_set_timing(&prof, k >= 2 ? clk : NULL, k == 3 ? 16 : 1);
+                    ops = pq_profile_ops(HEAPS[h].ops, &prof);
+                }
+                uint64_t t0 = now_ns();
+                DijkstraResult d = dijkstra_run_csr(csr, 0, ops);
+                t[r] = (double)(now_ns() - t0) / 1e6;
+                dijkstra_free(d);
+            }
+            double ms = sample_stats(t, reps).median;
+            if (k == 0) {
+                base_ms = ms;
+                fprintf(stderr, "[profile] %-9s %-6s %8.2fms\n", HEAPS[h].name, modes[k], ms);
+                continue;
+            }
+            fprintf(stderr, "[profile] %-9s %-6s %8.2fms (%+6.1f%%)  mean ns insert %.0f extract %.0f decrease %.0f"
+                            "  extract p50/p99/p99.9 %.0f/%.0f/%.0f\n",
+                    HEAPS[h].name, modes[k], ms, 100.0 * (ms - base_ms) / base_ms,
+                    prof.insert_count ? (double)prof.insert_ns / prof.insert_count : 0.0,
+                    prof.extract_count ? (double)prof.extract_ns / prof.extract_count : 0.0,
+                    prof.decrease_count ? (double)prof.decrease_ns / prof.decrease_count : 0.0,
+                    latency_hist_quantile(&prof.hist[PQ_OP_EXTRACT], 0.5),
+                    latency_hist_quantile(&prof.hist[PQ_OP_EXTRACT], 0.99),
+                    latency_hist_quantile(&prof.hist[PQ_OP_EXTRACT], 0.999));
+        }
+    }
+
+    free(t);
+    csr_destroy(csr);
+    graph_destroy(g);
+}
+
+enum {
+    SUITE_CORE = 1 << 0, SUITE_SCALING = 1 << 1, SUITE_MST = 1 << 2, SUITE_QUERY = 1 << 3,
+    SUITE_ST = 1 << 4, SUITE_BOUNDED = 1 << 5, SUITE_ALT = 1 << 6, SUITE_CH = 1 << 7,
+    SUITE_HUB = 1 << 8, SUITE_FILE = 1 << 9, SUITE_REORDER = 1 << 10, SUITE_PROFILE = 1 << 11,
+    SUITE_MQ = 1 << 12, SUITE_LAZY = 1 << 13, SUITE_DYN = 1 << 14, SUITE_DYNMST = 1 << 15,
+    SUITE_DENSE = 1 << 16,
+    SUITE_ALL = (1 << 17) - 1
+};
+
+static const struct { const char *name; unsigned bit; } SUITES[] = {
+    { "core", SUITE_CORE }, { "scaling", SUITE_SCALING }, { "mst", SUITE_MST },
+    { "query", SUITE_QUERY }, { "st", SUITE_ST }, { "bounded", SUITE_BOUNDED },
+    { "alt", SUITE_ALT }, { "ch", SUITE_CH }, { "hub", SUITE_HUB },
+    { "file", SUITE_FILE }, { "reorder", SUITE_REORDER }, { "profile", SUITE_PROFILE },
+    { "mq", SUITE_MQ }, { "lazy", SUITE_LAZY }, { "dyn", SUITE_DYN },
+    { "dynmst", SUITE_DYNMST }, { "dense", SUITE_DENSE },
+    { "all", SUITE_ALL },
+};
+
+static void usage(void) {
+    fprintf(stderr,
+        "usage: bench [options]\n"
+        "  --suite LIST     comma list of: core scaling mst query st bounded alt ch hub\n"
+        "                   file reorder profile mq lazy dyn dynmst dense all (default: all)\n"
+        "  --family LIST    core graph families: random grid rmat geometric complete all\n"
+        "                   (default: random)\n"
+        "  --n LIST         core vertex counts (default: 200,500,1000)\n"
+        "  --m M            core edge count (default: degree * n)\n"
+        "  --degree D       core average out-degree when --m is not given (default: 4)\n"
+        "  --undirected     generate undirected core graphs (default: directed)\n"
+        "  --seed S         RNG seed for graphs and sources (default: 123456789)\n"
+        "  --trials T       timed runs per case (default: 5)\n"
+        "  --warmup W       untimed runs per case before the trials (default: 1)\n"
+        "  --csv FILE       summary CSV (default: stdout)\n"
+        "  --json FILE      summary JSON\n"
+        "  --timing MODE    heap-operation timing: clock (clock_gettime, default) or tsc\n"
+        "                   (calibrated cycle counter, read overhead subtracted)\n"
+        "  --sample N       time only every N-th heap operation (sums are scaled up)\n"
+        "  --hw             per-operation hardware counters (Linux perf_event_open;\n"
+        "                   columns stay empty when counters are unavailable)\n"
+        "  --load FILE      parse a DIMACS/edge-list file and time it instead\n");
+}
+
+// Splits a comma list in place; returns the number of items.
+static int split_list(char *arg, char **items, int max_items) {
+    int count = 0;
+    for (char *tok = strtok(arg, ","); tok && count < max_items; tok = strtok(NULL, ","))
+        items[count++] = tok;
+    return count;
+}
+
+static int parse_options(int argc, char **argv, BenchOptions *opt) {
+    memset(opt, 0, sizeof(*opt));
+    opt->families[0] = GEN_RANDOM;
+    opt->family_count = 1;
+    opt->sizes[0] = 200;
+    opt->sizes[1] = 500;
+    opt->sizes[2] = 1000;
+    opt->size_count = 3;
+    opt->degree = 4.0;
+    opt->directed = 1;
+    opt->seed = 123456789;
+    opt->trials = 5;
+    opt->warmup = 1;
+    opt->suites = SUITE_ALL;
+
+    for (int i = 1; i < argc; i++) {
+        const char *a = argv[i];
+        if (strcmp(a, "--undirected") == 0) { opt->directed = 0; continue; }
+        if (strcmp(a, "--hw") == 0) { opt->hw = 1; continue; }
+        if (strcmp(a, "--help") == 0 || i + 1 >= argc) return -1;
+        char *v = argv[++i];
+        char *items[32];
+
+        if (strcmp(a, "--suite") == 0) {
+            opt->suites = 0;
+            int k = split_list(v, items, 32);
+            for (int j = 0; j < k; j++) {
+                unsigned bit = 0;
+                for (int s = 0; s < (int)(sizeof(SUITES) / sizeof(SUITES[0])); s++)
+                    if (strcmp(items[j], SUITES[s].name) == 0) bit = SUITES[s].bit;
+                if (!bit) { fprintf(stderr, "bench: unknown suite '%s'\n", items[j]); return -1; }
+                opt->suites |= bit;
+            }
+        } else if (strcmp(a, "--family") == 0) {
+            opt->family_count = 0;
+            int k = split_list(v, items, 32);
+            for (int j = 0; j < k; j++) {
+                if (strcmp(items[j], "all") == 0) {
+                    opt->family_count = 0;
+                    for (int f = 0; f < GEN_FAMILY_COUNT; f++) opt->families[opt->family_count++] = (GraphFamily)f;
+                    break;
+                }
+                GraphFamily f;
+                if (graph_family_parse(items[j], &f) != 0 || opt->family_count == GEN_FAMILY_COUNT) {
+                    fprintf(stderr, "bench: unknown family '%s'\n", items[j]);
+                    return -1;
+                }
+                opt->families[opt->family_count++] = f;
+            }
+        } else if (strcmp(a, "--n") == 0) {
+            opt->size_count = split_list(v, items, 32);
+            for (int j = 0; j < opt->size_count; j++) opt->sizes[j] = atoi(items[j]);
+        } else if (strcmp(a, "--m") == 0) {
+            opt->m = atoll(v);
+        } else if (strcmp(a, "--degree") == 0) {
+            opt->degree = atof(v);
+        } else if (strcmp(a, "--seed") == 0) {
+            opt->seed = strtoull(v, NULL, 10);
+        } else if (strcmp(a, "--trials") == 0) {
+            opt->trials = atoi(v);
+        } else if (strcmp(a, "--warmup") == 0) {
+            opt->warmup = atoi(v);
+        } else if (strcmp(a, "--csv") == 0) {
+            opt->csv_path = v;
+        } else if (strcmp(a, "--json") == 0) {
+            opt->json_path = v;
+        } else if (strcmp(a, "--load") == 0) {
+            opt->load_path = v;
+        } else if (strcmp(a, "--timing") == 0) {
+            if (strcmp(v, "tsc") == 0) opt->tsc = 1;
+            else if (strcmp(v, "clock") != 0) { fprintf(stderr, "bench: unknown timing '%s'\n", v); return -1; }
+        } else if (strcmp(a, "--sample") == 0) {
+            opt->sample = (unsigned)atoi(v);
+        } else {
+            fprintf(stderr, "bench: unknown option '%s'\n", a);
+            return -1;
+        }
+    }
+
+    if (opt->trials < 1) opt->trials = 1;
+    if (opt->warmup < 0) opt->warmup = 0;
+    for (int j = 0; j < opt->size_count; j++) {
+        if (opt->sizes[j] < 1) { fprintf(stderr, "bench: bad --n value\n"); return -1; }
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    BenchOptions opt;
+    if (parse_options(argc, argv, &opt) != 0) {
+        usage();
+        return 2;
+    }
+    if (opt.load_path) return run_load(opt.load_path);
+    rng_state = (uint32_t)(opt.seed ^ (opt.seed >> 32));
+    if (rng_state == 0) rng_state = 123456789;
+
+    if (opt.tsc || (opt.suites & (SUITE_PROFILE | SUITE_QUERY))) tsc_calibrate(&opt.tsc_clock);
+    if (opt.hw) {
+        int opened = perf_counters_open(&opt.perf);
+        fprintf(stderr, "[hw] %d of %d hardware counters available", opened, PERF_COUNTER_COUNT);
+        if (opened == 0) fprintf(stderr, " (perf_event_open denied or unsupported; wall clock only)");
+        fprintf(stderr, "\n");
+    }
+
+    BenchOutput out;
+    output_open(&out, &opt);
+
+    if (opt.suites & SUITE_CORE) {
+        for (int f = 0; f < opt.family_count; f++) {
+            const char *family = graph_family_name(opt.families[f]);
+            for (int si = 0; si < opt.size_count; si++) {
+                int n = opt.sizes[si];
+                long long m = opt.m > 0 ? opt.m : (long long)(opt.degree * n);
+                fprintf(stderr, "\n[progress] building %s graph n=%d m=%lld\n", family, n, m);
+                fflush(stderr);
+                Graph *g = graph_generate(opt.families[f], n, m, opt.directed, opt.seed);
+                run_all(&opt, &out, family, g);
+                graph_destroy(g);
+            }
+        }
+    }
+
+    if (opt.suites & SUITE_SCALING) run_scaling(200000, 4 * 200000);
+    if (opt.suites & SUITE_MQ) run_multiqueue(200000, 4 * 200000);
+    if (opt.suites & SUITE_LAZY) run_lazy_compare(100000, 3);
+    if (opt.suites & SUITE_DYN) run_dynamic_sssp(200000, 4 * 200000, 10);
+    if (opt.suites & SUITE_DYNMST) run_dynamic_mst(450, 1000, 10);
+    if (opt.suites & SUITE_MST) run_mst_compare(200000, 4 * 200000);
+    if (opt.suites & SUITE_DENSE) run_dense_prim(4000, 3);
+    if (opt.suites & SUITE_QUERY) run_query_batch(&opt.tsc_clock, 20000, 4 * 20000, 500, 5);
+    if (opt.suites & SUITE_ST) run_st_queries(100000, 4 * 100000, 200);
+    if (opt.suites & SUITE_BOUNDED) run_bounded_queries(20, 2000);
+    if (opt.suites & SUITE_ALT) run_alt_queries(100000, 4 * 100000, 8, 200);
+    if (opt.suites & SUITE_CH) run_ch_queries(200, 1000);
+    if (opt.suites & SUITE_HUB) run_hub_labels(10000, 2 * 10000, 10000);
+    if (opt.suites & SUITE_FILE) run_graph_file(1000000, 4 * 1000000);
+    if (opt.suites & SUITE_REORDER) run_reorder(1000000, 4 * 1000000, 3);
+    if (opt.suites & SUITE_PROFILE) run_profile_overhead(&opt.tsc_clock, 200000, 4 * 200000, 5);
 
+    output_close(&out);
+    if (opt.hw) perf_counters_close(&opt.perf);
     fprintf(stderr, "\n[progress] bench done\n");
     fflush(stderr);
     return 0;
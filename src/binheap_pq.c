@@ -1,5 +1,6 @@
 // binheap_pq.c
 #include "binheap_pq.h"
+#include "node_pool.h"
 #include <stdlib.h>
 #include <stdio.h>
 
@@ -13,6 +14,7 @@ struct PQ {
     int size;
     int cap;
     PQHandle** a; // heap array of pointers to handles
+    NodePool pool; // handle slabs: extract recycles, clear resets without freeing
 };
 
 static void swap_nodes(PQ* pq, int i, int j) {
@@ -50,12 +52,12 @@ static PQ* bh_create(int capacity) {
     pq->size = 0;
     pq->cap = capacity > 0 ? capacity : 1;
     pq->a = (PQHandle**)malloc(sizeof(PQHandle*) * pq->cap);
+    node_pool_init(&pq->pool, sizeof(PQHandle), pq->cap);
     return pq;
 }
 
 static void bh_destroy(PQ* pq) {
-    // handles were allocated in insert, free them
-    for (int i = 0; i < pq->size; i++) free(pq->a[i]);
+    node_pool_release(&pq->pool);
     free(pq->a);
     free(pq);
 }
@@ -65,7 +67,7 @@ static PQHandle* bh_insert(PQ* pq, long long key, int value) {
         pq->cap *= 2;
         pq->a = (PQHandle**)realloc(pq->a, sizeof(PQHandle*) * pq->cap);
     }
-    PQHandle* h = (PQHandle*)malloc(sizeof(PQHandle));
+    PQHandle* h = (PQHandle*)node_pool_alloc(&pq->pool);
     h->key = key;
     h->value = value;
     h->idx = pq->size;
@@ -74,6 +76,30 @@ static PQHandle* bh_insert(PQ* pq, long long key, int value) {
     return h;
 }
 
+static void bh_build(PQ* pq, const PQItem* items, int count, PQHandle** handles) {
+    int old = pq->size;
+    if (old + count > pq->cap) {
+        while (old + count > pq->cap) pq->cap *= 2;
+        pq->a = (PQHandle**)realloc(pq->a, sizeof(PQHandle*) * pq->cap);
+    }
+    for (int i = 0; i < count; i++) {
+        PQHandle* h = (PQHandle*)node_pool_alloc(&pq->pool);
+        h->key = items[i].key;
+        h->value = items[i].value;
+        h->idx = old + i;
+        pq->a[old + i] = h;
+        if (handles) handles[i] = h;
+    }
+    pq->size = old + count;
+
+    if (count > old) {
+        // Floyd's bottom-up heapify: O(size)
+        for (int i = pq->size / 2 - 1; i >= 0; i--) sift_down(pq, i);
+    } else {
+        for (int i = old; i < pq->size; i++) sift_up(pq, i);
+    }
+}
+
 static PQItem bh_extract_min(PQ* pq) {
     if (pq->size == 0) {
         fprintf(stderr, "extract_min on empty heap\n");
@@ -88,7 +114,7 @@ static PQItem bh_extract_min(PQ* pq) {
         pq->a[0]->idx = 0;
         sift_down(pq, 0);
     }
-    free(root);
+    node_pool_free(&pq->pool, root);
     return out;
 }
 
@@ -105,11 +131,18 @@ static int bh_is_empty(PQ* pq) {
     return pq->size == 0;
 }
 
+static void bh_clear(PQ* pq) {
+    node_pool_reset(&pq->pool);
+    pq->size = 0;
+}
+
 const PQOps BINHEAP_OPS = {
     .create = bh_create,
     .destroy = bh_destroy,
     .insert = bh_insert,
     .extract_min = bh_extract_min,
     .decrease_key = bh_decrease_key,
-    .is_empty = bh_is_empty
+    .build = bh_build,
+    .is_empty = bh_is_empty,
+    .clear = bh_clear
 };
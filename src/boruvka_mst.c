@@ -0,0 +1,197 @@
+// boruvka_mst.c
+#include "boruvka_mst.h"
+#include "thread_team.h"
+#include <stdlib.h>
+
+typedef struct {
+    int* data;
+    int size;
+    int cap;
+} IntVec;
+
+static void vec_push(IntVec* v, int x) {
+    if (v->size == v->cap) {
+        v->cap = v->cap ? v->cap * 2 : 64;
+        v->data = (int*)realloc(v->data, sizeof(int) * (size_t)v->cap);
+    }
+    v->data[v->size++] = x;
+}
+
+enum { PHASE_COMPRESS, PHASE_BEST, PHASE_HOOK };
+
+typedef struct {
+    const CSRGraph* g;
+    int* src;       // source vertex of each arc
+    int* uf;        // union-find parent (updated with CAS)
+    int* comp;      // component root of each vertex for this round
+    int* best;      // cheapest outgoing arc per component root, -1 if none
+    IntVec* chosen; // per thread: arcs added to the MST
+    int* merged;    // per thread: successful unions this round
+    int phase;
+} BVState;
+
+// Strict total order on undirected edges: weight, then endpoint ids.
+static int arc_less(const BVState* st, int a, int b) {
+    int wa = st->g->weights[a], wb = st->g->weights[b];
+    if (wa != wb) return wa < wb;
+    int ua = st->src[a], va = st->g->targets[a];
+    int ub = st->src[b], vb = st->g->targets[b];
+    int la = ua < va ? ua : va, ha = ua < va ? va : ua;
+    int lb = ub < vb ? ub : vb, hb = ub < vb ? vb : ub;
+    if (la != lb) return la < lb;
+    return ha < hb;
+}
+
+static int uf_find(int* uf, int x) {
+    for (;;) {
+        int p = __atomic_load_n(&uf[x], __ATOMIC_RELAXED);
+        if (p == x) return x;
+        int gp = __atomic_load_n(&uf[p], __ATOMIC_RELAXED);
+        if (gp != p) __atomic_compare_exchange_n(&uf[x], &p, gp, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+        x = gp;
+    }
+}
+
+// Returns 1 if this call merged two sets.
+static int uf_union(int* uf, int a, int b) {
+    for (;;) {
+        a = uf_find(uf, a);
+        b = uf_find(uf, b);
+        if (a == b) return 0;
+        if (a < b) { int t = a; a = b; b = t; }
+        int expect = a;
+        if (__atomic_compare_exchange_n(&uf[a], &expect, b, 0, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED))
+            return 1;
+    }
+}
+
+static void offer_best(BVState* st, int c, int k) {
+    int cur = __atomic_load_n(&st->best[c], __ATOMIC_RELAXED);
+    while (cur < 0 || arc_less(st, k, cur)) {
+        if (__atomic_compare_exchange_n(&st->best[c], &cur, k, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            return;
+    }
+}
+
+static void bv_work(void* ctx, int tid, int nthreads) {
+    BVState* st = (BVState*)ctx;
+    const int* off = st->g->offsets;
+    const int* to = st->g->targets;
+    int lo, hi;
+    team_block(st->g->n, tid, nthreads, &lo, &hi);
+
+    for (int u = lo; u < hi; u++) {
+        if (st->phase == PHASE_COMPRESS) {
+            st->comp[u] = uf_find(st->uf, u);
+            st->best[u] = -1;
+        } else if (st->phase == PHASE_BEST) {
+            int cu = st->comp[u];
+            for (int k = off[u]; k < off[u + 1]; k++) {
+                int cv = st->comp[to[k]];
+                if (cu == cv) continue;
+                offer_best(st, cu, k);
+                offer_best(st, cv, k); // also covers one-way arcs of directed input
+            }
+        } else {
+            // u is a component root with a cheapest edge: hook it
+            int k = st->best[u];
+            if (st->comp[u] != u || k < 0) continue;
+            if (uf_union(st->uf, st->src[k], to[k])) {
+                vec_push(&st->chosen[tid], k);
+                st->merged[tid]++;
+            }
+        }
+    }
+}
+
+PrimResult boruvka_mst_run(const CSRGraph* g, int root, int num_threads) {
+    int n = g->n;
+    BVState st;
+    st.g = g;
+    st.src = (int*)malloc(sizeof(int) * (size_t)(g->m > 0 ? g->m : 1));
+    st.uf = (int*)malloc(sizeof(int) * n);
+    st.comp = (int*)malloc(sizeof(int) * n);
+    st.best = (int*)malloc(sizeof(int) * n);
+
+    ThreadTeam* team = team_create(num_threads);
+    int T = team_size(team);
+    st.chosen = (IntVec*)calloc((size_t)T, sizeof(IntVec));
+    st.merged = (int*)calloc((size_t)T, sizeof(int));
+
+    for (int u = 0; u < n; u++) {
+        st.uf[u] = u;
+        for (int k = g->offsets[u]; k < g->offsets[u + 1]; k++) st.src[k] = u;
+    }
+
+    for (;;) {
+        st.phase = PHASE_COMPRESS;
+        team_run(team, bv_work, &st);
+        st.phase = PHASE_BEST;
+        team_run(team, bv_work, &st);
+        st.phase = PHASE_HOOK;
+        for (int t = 0; t < T; t++) st.merged[t] = 0;
+        team_run(team, bv_work, &st);
+
+        int merged = 0;
+        for (int t = 0; t < T; t++) merged += st.merged[t];
+        if (merged == 0) break;
+    }
+    team_destroy(team);
+
+    // Orient the forest from root: adjacency of chosen edges, then BFS
+    int* deg = (int*)calloc((size_t)n + 1, sizeof(int));
+    int edges = 0;
+    for (int t = 0; t < T; t++) {
+        for (int i = 0; i < st.chosen[t].size; i++) {
+            int k = st.chosen[t].data[i];
+            deg[st.src[k] + 1]++;
+            deg[g->targets[k] + 1]++;
+        }
+        edges += st.chosen[t].size;
+    }
+    for (int u = 0; u < n; u++) deg[u + 1] += deg[u];
+    int* adj = (int*)malloc(sizeof(int) * (size_t)(2 * edges + 1));
+    int* fill = (int*)malloc(sizeof(int) * n);
+    for (int u = 0; u < n; u++) fill[u] = deg[u];
+    for (int t = 0; t < T; t++) {
+        for (int i = 0; i < st.chosen[t].size; i++) {
+            int k = st.chosen[t].data[i];
+            adj[fill[st.src[k]]++] = k;
+            adj[fill[g->targets[k]]++] = k;
+        }
+    }
+
+    int* parent = (int*)malloc(sizeof(int) * n);
+    for (int u = 0; u < n; u++) parent[u] = -1;
+    int* queue = fill; // reuse: fill is no longer needed
+    int qh = 0, qt = 0;
+    long long total = 0;
+    parent[root] = root;
+    queue[qt++] = root;
+    while (qh < qt) {
+        int u = queue[qh++];
+        for (int i = deg[u]; i < deg[u + 1]; i++) {
+            int k = adj[i];
+            int v = st.src[k] == u ? g->targets[k] : st.src[k];
+            if (parent[v] != -1) continue;
+            parent[v] = u;
+            total += g->weights[k];
+            queue[qt++] = v;
+        }
+    }
+    parent[root] = -1;
+
+    for (int t = 0; t < T; t++) free(st.chosen[t].data);
+    free(st.chosen);
+    free(st.merged);
+    free(st.src);
+    free(st.uf);
+    free(st.comp);
+    free(st.best);
+    free(deg);
+    free(adj);
+    free(fill);
+
+    PrimResult r = { total, parent };
+    return r;
+}
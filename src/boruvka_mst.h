@@ -0,0 +1,15 @@
+// boruvka_mst.h
+#ifndef BORUVKA_MST_H
+#define BORUVKA_MST_H
+
+#include "csr_graph.h"
+#include "prim.h"
+
+// Multithreaded Borůvka MST with a lock-free union-find.
+// Arcs are treated as undirected edges. Returns a PrimResult-compatible
+// result for the component containing `root`: parent[] is the MST rooted
+// at root (-1 for root and unreached vertices) and mst_weight its total.
+// Free with prim_free.
+PrimResult boruvka_mst_run(const CSRGraph* g, int root, int num_threads);
+
+#endif
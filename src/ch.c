@@ -0,0 +1,266 @@
+// ch.c
+#include "ch.h"
+#include "binheap_pq.h"
+#include "dijkstra.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define INF DIJKSTRA_INF
+
+// Witness searches give up (and keep the shortcut) after settling this many
+// vertices; priority estimates use a cheaper bound than real contractions.
+#define CH_WITNESS_LIMIT 500
+#define CH_ESTIMATE_LIMIT 40
+
+typedef struct {
+    int to;
+    long long w;
+} Arc;
+
+typedef struct {
+    Arc* a;
+    int size;
+    int cap;
+} ArcList;
+
+// Remaining (uncontracted) graph plus the bookkeeping of the contraction
+typedef struct {
+    int n;
+    ArcList* out;
+    ArcList* in;
+    int* deleted;       // contracted neighbours of v (ordering term)
+    int* level;         // 1 + highest level among contracted neighbours
+    unsigned* mark;     // mark[w] == mark_gen: w is a target of the current witness searches
+    unsigned mark_gen;
+    SearchContext* wit; // witness search state
+} CHBuilder;
+
+static void arcs_push(ArcList* l, int to, long long w) {
+    if (l->size == l->cap) {
+        l->cap = l->cap ? l->cap * 2 : 4;
+        l->a = (Arc*)realloc(l->a, sizeof(Arc) * (size_t)l->cap);
+    }
+    l->a[l->size].to = to;
+    l->a[l->size].w = w;
+    l->size++;
+}
+
+static void arcs_remove(ArcList* l, int to) {
+    for (int i = 0; i < l->size; i++) {
+        if (l->a[i].to == to) {
+            l->a[i] = l->a[--l->size];
+            return;
+        }
+    }
+}
+
+// Adds u -> v with weight w, or lowers the existing arc. Keeps out/in in sync.
+static int add_or_lower(CHBuilder* b, int u, int v, long long w) {
+    ArcList* out = &b->out[u];
+    for (int i = 0; i < out->size; i++) {
+        if (out->a[i].to != v) continue;
+        if (w >= out->a[i].w) return 0;
+        out->a[i].w = w;
+        ArcList* in = &b->in[v];
+        for (int j = 0; j < in->size; j++)
+            if (in->a[j].to == u) { in->a[j].w = w; break; }
+        return 0;
+    }
+    arcs_push(out, v, w);
+    arcs_push(&b->in[v], u, w);
+    return 1;
+}
+
+// Dijkstra from u in the remaining graph without v, up to `limit`; stops
+// early once all `targets` marked vertices are settled.
+static void witness_search(CHBuilder* b, int u, int v, long long limit, int targets, int max_settled) {
+    SearchContext* ctx = b->wit;
+    search_ctx_begin(ctx);
+    search_ctx_relax(ctx, u, 0, 0, -1);
+
+    int x;
+    long long dx;
+    while (search_ctx_pop(ctx, &x, &dx)) {
+        if (dx > limit || ctx->settled > max_settled) break;
+        if (b->mark[x] == b->mark_gen && --targets == 0) break;
+        const ArcList* l = &b->out[x];
+        for (int i = 0; i < l->size; i++) {
+            if (l->a[i].to == v) continue;
+            long long nd = dx + l->a[i].w;
+            if (nd <= limit) search_ctx_relax(ctx, l->a[i].to, nd, nd, x);
+        }
+    }
+}
+
+// Shortcuts needed to contract v; added to the graph when `apply` is set.
+static int contract(CHBuilder* b, int v, int apply) {
+    const ArcList* in = &b->in[v];
+    const ArcList* out = &b->out[v];
+    if (in->size == 0 || out->size == 0) return 0;
+
+    long long max_out = 0;
+    if (++b->mark_gen == 0) {
+        memset(b->mark, 0, sizeof(unsigned) * (size_t)b->n);
+        b->mark_gen = 1;
+    }
+    for (int j = 0; j < out->size; j++) {
+        if (out->a[j].w > max_out) max_out = out->a[j].w;
+        b->mark[out->a[j].to] = b->mark_gen;
+    }
+
+    int added = 0;
+    for (int i = 0; i < in->size; i++) {
+        int u = in->a[i].to;
+        long long wu = in->a[i].w;
+        witness_search(b, u, v, wu + max_out, out->size,
+                       apply ? CH_WITNESS_LIMIT : CH_ESTIMATE_LIMIT);
+        for (int j = 0; j < out->size; j++) {
+            int w = out->a[j].to;
+            if (w == u) continue;
+            long long via = wu + out->a[j].w;
+            if (search_ctx_dist(b->wit, w) <= via) continue; // witness found
+            added++;
+            if (apply) add_or_lower(b, u, w, via);
+        }
+    }
+    return added;
+}
+
+static long long priority(CHBuilder* b, int v) {
+    long long edge_diff = contract(b, v, 0) - b->in[v].size - b->out[v].size;
+    return 2 * edge_diff + b->deleted[v] + b->level[v];
+}
+
+// Packs the arcs left at each vertex when it was contracted into CSR form.
+static void pack(int n, ArcList* lists, int** off, int** to, long long** w) {
+    *off = (int*)malloc(sizeof(int) * (size_t)(n + 1));
+    (*off)[0] = 0;
+    for (int v = 0; v < n; v++) (*off)[v + 1] = (*off)[v] + lists[v].size;
+    int m = (*off)[n];
+    *to = (int*)malloc(sizeof(int) * (size_t)(m > 0 ? m : 1));
+    *w = (long long*)malloc(sizeof(long long) * (size_t)(m > 0 ? m : 1));
+    for (int v = 0; v < n; v++) {
+        for (int i = 0; i < lists[v].size; i++) {
+            (*to)[(*off)[v] + i] = lists[v].a[i].to;
+            (*w)[(*off)[v] + i] = lists[v].a[i].w;
+        }
+    }
+}
+
+CHGraph* ch_build(const Graph* g, const PQOps* ops) {
+    int n = g->n;
+    CHBuilder b;
+    b.n = n;
+    b.out = (ArcList*)calloc((size_t)n, sizeof(ArcList));
+    b.in = (ArcList*)calloc((size_t)n, sizeof(ArcList));
+    b.deleted = (int*)calloc((size_t)n, sizeof(int));
+    b.level = (int*)calloc((size_t)n, sizeof(int));
+    b.mark = (unsigned*)calloc((size_t)n, sizeof(unsigned));
+    b.mark_gen = 0;
+    b.wit = search_ctx_create(n, ops);
+
+    // Parallel arcs collapse to the lightest one; self loops never help
+    for (int u = 0; u < n; u++)
+        for (Edge* e = g->adj[u]; e; e = e->next)
+            if (e->to != u) add_or_lower(&b, u, e->to, e->w);
+
+    CHGraph* ch = (CHGraph*)malloc(sizeof(CHGraph));
+    ch->n = n;
+    ch->rank = (int*)malloc(sizeof(int) * (size_t)n);
+    ch->shortcuts = 0;
+
+    // Lazy ordering: a popped vertex whose priority went up since it was
+    // queued (its neighbourhood changed) is pushed back instead of contracted.
+    PQ* order = BINHEAP_OPS.create(n);
+    for (int v = 0; v < n; v++) BINHEAP_OPS.insert(order, priority(&b, v), v);
+
+    int next_rank = 0;
+    while (!BINHEAP_OPS.is_empty(order)) {
+        PQItem it = BINHEAP_OPS.extract_min(order);
+        int v = it.value;
+        long long p = priority(&b, v);
+        if (p > it.key && !BINHEAP_OPS.is_empty(order)) {
+            BINHEAP_OPS.insert(order, p, v);
+            continue;
+        }
+
+        ch->rank[v] = next_rank++;
+        ch->shortcuts += contract(&b, v, 1);
+
+        // Detach v; its remaining arcs all lead to higher ranks and stay in
+        // b.out[v] / b.in[v] as its upward / downward arcs.
+        for (int d = 0; d < 2; d++) {
+            const ArcList* l = d ? &b.out[v] : &b.in[v];
+            for (int i = 0; i < l->size; i++) {
+                int x = l->a[i].to;
+                arcs_remove(d ? &b.in[x] : &b.out[x], v);
+                b.deleted[x]++;
+                if (b.level[x] < b.level[v] + 1) b.level[x] = b.level[v] + 1;
+            }
+        }
+    }
+    BINHEAP_OPS.destroy(order);
+
+    pack(n, b.out, &ch->up_off, &ch->up_to, &ch->up_w);
+    pack(n, b.in, &ch->down_off, &ch->down_to, &ch->down_w);
+
+    for (int v = 0; v < n; v++) {
+        free(b.out[v].a);
+        free(b.in[v].a);
+    }
+    free(b.out);
+    free(b.in);
+    free(b.deleted);
+    free(b.level);
+    free(b.mark);
+    search_ctx_destroy(b.wit);
+    return ch;
+}
+
+void ch_destroy(CHGraph* ch) {
+    free(ch->rank);
+    free(ch->up_off);
+    free(ch->up_to);
+    free(ch->up_w);
+    free(ch->down_off);
+    free(ch->down_to);
+    free(ch->down_w);
+    free(ch);
+}
+
+STResult ch_query(const CHGraph* ch, SearchContext* fwd, SearchContext* bwd, int s, int t) {
+    STResult r = { INF, 0 };
+    search_ctx_begin(fwd);
+    search_ctx_begin(bwd);
+    search_ctx_relax(fwd, s, 0, 0, -1);
+    search_ctx_relax(bwd, t, 0, 0, -1);
+
+    SearchContext* ctx[2] = { fwd, bwd };
+    const int* off[2] = { ch->up_off, ch->down_off };
+    const int* to[2] = { ch->up_to, ch->down_to };
+    const long long* wt[2] = { ch->up_w, ch->down_w };
+    int done[2] = { 0, 0 };
+
+    // Alternate directions; a side stops once its next key cannot beat the
+    // best meeting point. The top-ranked vertex of a shortest path is settled
+    // by both sides, so the answer is found before both stop.
+    while (!done[0] || !done[1]) {
+        for (int d = 0; d < 2; d++) {
+            if (done[d]) continue;
+            int u;
+            long long du;
+            if (!search_ctx_pop(ctx[d], &u, &du) || du >= r.dist) { done[d] = 1; continue; }
+
+            long long other = search_ctx_dist(ctx[1 - d], u);
+            if (other < INF && du + other < r.dist) r.dist = du + other;
+
+            for (int k = off[d][u]; k < off[d][u + 1]; k++) {
+                long long nd = du + wt[d][k];
+                search_ctx_relax(ctx[d], to[d][k], nd, nd, u);
+            }
+        }
+    }
+
+    r.settled = fwd->settled + bwd->settled;
+    return r;
+}
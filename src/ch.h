@@ -0,0 +1,37 @@
+// ch.h
+#ifndef CH_H
+#define CH_H
+
+#include "graph.h"
+#include "pq.h"
+#include "search_ctx.h"
+#include "st_query.h"
+
+// Contraction hierarchy over a static Graph. Vertices are contracted in
+// rank order; every arc kept is stored at its lower-ranked endpoint, so both
+// query directions only ever climb to higher ranks.
+typedef struct {
+    int n;
+    int* rank;          // rank[v]: position of v in the contraction order
+    // Upward graph (forward search): arcs v -> up_to[k], rank grows
+    int* up_off;
+    int* up_to;
+    long long* up_w;
+    // Downward graph reversed (backward search): arcs down_to[k] -> v, rank grows
+    int* down_off;
+    int* down_to;
+    long long* down_w;
+    long long shortcuts; // arcs added by contraction
+} CHGraph;
+
+// Builds the hierarchy. Node order comes from a lazily updated priority
+// (edge difference plus contracted neighbours) kept in a binary heap, since
+// those keys move in both directions; witness searches run on `ops`.
+CHGraph* ch_build(const Graph* g, const PQOps* ops);
+void     ch_destroy(CHGraph* ch);
+
+// Bidirectional upward query. fwd and bwd are contexts over ch->n vertices
+// (any PQOps backend); they are reset by the call and can be reused.
+STResult ch_query(const CHGraph* ch, SearchContext* fwd, SearchContext* bwd, int s, int t);
+
+#endif
@@ -0,0 +1,72 @@
+// csr_graph.c
+#include "csr_graph.h"
+#include <stdlib.h>
+
+static CSRGraph* csr_alloc(int n, int m, int directed) {
+    CSRGraph* g = (CSRGraph*)malloc(sizeof(CSRGraph));
+    g->n = n;
+    g->m = m;
+    g->directed = directed;
+    g->offsets = (int*)calloc((size_t)n + 1, sizeof(int));
+    g->targets = (int*)malloc(sizeof(int) * (size_t)(m > 0 ? m : 1));
+    g->weights = (int*)malloc(sizeof(int) * (size_t)(m > 0 ? m : 1));
+    return g;
+}
+
+CSRGraph* csr_from_graph(const Graph* g) {
+    int n = g->n;
+    int m = 0;
+    for (int u = 0; u < n; u++)
+        for (Edge* e = g->adj[u]; e; e = e->next) m++;
+
+    CSRGraph* c = csr_alloc(n, m, g->directed);
+
+    int k = 0;
+    for (int u = 0; u < n; u++) {
+        c->offsets[u] = k;
+        for (Edge* e = g->adj[u]; e; e = e->next) {
+            c->targets[k] = e->to;
+            c->weights[k] = e->w;
+            k++;
+        }
+    }
+    c->offsets[n] = k;
+    return c;
+}
+
+CSRGraph* csr_from_edges(int n, int count, const int* src, const int* dst,
+                         const int* w, int directed) {
+    int m = directed ? count : 2 * count;
+    CSRGraph* c = csr_alloc(n, m, directed);
+
+    // Counting sort by source: degrees first, then prefix sums.
+    for (int i = 0; i < count; i++) {
+        c->offsets[src[i] + 1]++;
+        if (!directed) c->offsets[dst[i] + 1]++;
+    }
+    for (int u = 0; u < n; u++) c->offsets[u + 1] += c->offsets[u];
+
+    int* fill = (int*)malloc(sizeof(int) * (size_t)(n > 0 ? n : 1));
+    for (int u = 0; u < n; u++) fill[u] = c->offsets[u];
+
+    for (int i = 0; i < count; i++) {
+        int k = fill[src[i]]++;
+        c->targets[k] = dst[i];
+        c->weights[k] = w[i];
+        if (!directed) {
+            k = fill[dst[i]]++;
+            c->targets[k] = src[i];
+            c->weights[k] = w[i];
+        }
+    }
+
+    free(fill);
+    return c;
+}
+
+void csr_destroy(CSRGraph* g) {
+    free(g->offsets);
+    free(g->targets);
+    free(g->weights);
+    free(g);
+}
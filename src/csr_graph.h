@@ -0,0 +1,28 @@
+// csr_graph.h
+#ifndef CSR_GRAPH_H
+#define CSR_GRAPH_H
+
+#include "graph.h"
+
+// Frozen compressed sparse row form of a Graph.
+// Edges of vertex u live in [offsets[u], offsets[u+1]) of targets/weights.
+typedef struct {
+    int n;
+    int m;          // number of stored arcs (undirected edges appear twice)
+    int directed;
+    int* offsets;   // n + 1 entries
+    int* targets;   // m entries
+    int* weights;   // m entries
+} CSRGraph;
+
+// Build from an existing adjacency-list graph (keeps per-vertex edge order).
+CSRGraph* csr_from_graph(const Graph* g);
+
+// Build straight from an edge stream of `count` edges (src[i] -> dst[i], weight w[i]).
+// For undirected graphs each edge is stored in both directions, like graph_add_edge.
+CSRGraph* csr_from_edges(int n, int count, const int* src, const int* dst,
+                         const int* w, int directed);
+
+void csr_destroy(CSRGraph* g);
+
+#endif
@@ -0,0 +1,184 @@
+// dary_pq.c
+#include "dary_pq.h"
+#include <stdlib.h>
+#include <stdio.h>
+
+struct PQ {
+    int size;
+    int cap;
+    long long* key; // key[i]: key of heap slot i
+    int* val;       // val[i]: vertex in heap slot i
+    int* pos;       // pos[v]: slot of vertex v, or -1 if not in heap
+};
+
+// Sift helpers move a "hole" instead of swapping, and take the arity as a
+// constant so each ops table below gets its own fully unrolled copy.
+
+static inline void dary_sift_up(PQ* pq, int i, long long k, int v, const int d) {
+    while (i > 0) {
+        int p = (i - 1) / d;
+        if (pq->key[p] <= k) break;
+        pq->key[i] = pq->key[p];
+        pq->val[i] = pq->val[p];
+        pq->pos[pq->val[i]] = i;
+        i = p;
+    }
+    pq->key[i] = k;
+    pq->val[i] = v;
+    pq->pos[v] = i;
+}
+
+static inline void dary_sift_down(PQ* pq, int i, long long k, int v, const int d) {
+    int n = pq->size;
+    while (1) {
+        int first = d * i + 1;
+        if (first >= n) break;
+        int last = first + d < n ? first + d : n;
+        int m = first;
+        for (int c = first + 1; c < last; c++)
+            if (pq->key[c] < pq->key[m]) m = c;
+        if (pq->key[m] >= k) break;
+        pq->key[i] = pq->key[m];
+        pq->val[i] = pq->val[m];
+        pq->pos[pq->val[i]] = i;
+        i = m;
+    }
+    pq->key[i] = k;
+    pq->val[i] = v;
+    pq->pos[v] = i;
+}
+
+static void dary_check_vertex(PQ* pq, int v) {
+    if (v < 0 || v >= pq->cap) {
+        fprintf(stderr, "dary heap: vertex %d outside capacity %d\n", v, pq->cap);
+        exit(1);
+    }
+}
+
+static inline PQHandle* dary_insert(PQ* pq, long long key, int value, const int d) {
+    dary_check_vertex(pq, value);
+    int i = pq->pos[value];
+    if (i >= 0) {
+        // Already queued: treat as decrease-key (no duplicates in an indexed heap)
+        if (key < pq->key[i]) dary_sift_up(pq, i, key, value, d);
+    } else {
+        dary_sift_up(pq, pq->size++, key, value, d);
+    }
+    return PQ_HANDLE_FROM_VERTEX(value);
+}
+
+static inline PQItem dary_extract_min(PQ* pq, const int d) {
+    if (pq->size == 0) {
+        fprintf(stderr, "extract_min on empty heap\n");
+        exit(1);
+    }
+    PQItem out = { pq->key[0], pq->val[0] };
+    pq->pos[out.value] = -1;
+
+    pq->size--;
+    if (pq->size > 0)
+        dary_sift_down(pq, 0, pq->key[pq->size], pq->val[pq->size], d);
+    return out;
+}
+
+static inline void dary_decrease_key(PQ* pq, PQHandle* h, long long new_key, const int d) {
+    int v = PQ_HANDLE_TO_VERTEX(h);
+    dary_check_vertex(pq, v);
+    int i = pq->pos[v];
+    if (i < 0) {
+        fprintf(stderr, "decrease_key on vertex %d not in heap\n", v);
+        exit(1);
+    }
+    if (new_key > pq->key[i]) {
+        fprintf(stderr, "decrease_key called with larger key\n");
+        exit(1);
+    }
+    dary_sift_up(pq, i, new_key, v, d);
+}
+
+static inline void dary_build(PQ* pq, const PQItem* items, int count,
+                              PQHandle** handles, const int d) {
+    if (pq->size > 0) {
+        for (int i = 0; i < count; i++) {
+            PQHandle* h = dary_insert(pq, items[i].key, items[i].value, d);
+            if (handles) handles[i] = h;
+        }
+        return;
+    }
+    for (int i = 0; i < count; i++) {
+        int v = items[i].value;
+        dary_check_vertex(pq, v);
+        int j = pq->pos[v];
+        if (j >= 0) {
+            // Duplicate vertex in the batch: keep the smaller key
+            if (items[i].key < pq->key[j]) pq->key[j] = items[i].key;
+        } else {
+            j = pq->size++;
+            pq->key[j] = items[i].key;
+            pq->val[j] = v;
+            pq->pos[v] = j;
+        }
+        if (handles) handles[i] = PQ_HANDLE_FROM_VERTEX(v);
+    }
+    // Floyd's bottom-up heapify: O(size). (size - 2) / d truncates to 0 for
+    // size 0, so small heaps skip it rather than sift a stale slot 0.
+    if (pq->size <= 1) return;
+    for (int i = (pq->size - 2) / d; i >= 0; i--)
+        dary_sift_down(pq, i, pq->key[i], pq->val[i], d);
+}
+
+static PQ* dary_create(int capacity) {
+    PQ* pq = (PQ*)malloc(sizeof(PQ));
+    pq->size = 0;
+    pq->cap = capacity > 0 ? capacity : 1;
+    pq->key = (long long*)malloc(sizeof(long long) * pq->cap);
+    pq->val = (int*)malloc(sizeof(int) * pq->cap);
+    pq->pos = (int*)malloc(sizeof(int) * pq->cap);
+    for (int v = 0; v < pq->cap; v++) pq->pos[v] = -1;
+    return pq;
+}
+
+static void dary_destroy(PQ* pq) {
+    free(pq->key);
+    free(pq->val);
+    free(pq->pos);
+    free(pq);
+}
+
+static int dary_is_empty(PQ* pq) {
+    return pq->size == 0;
+}
+
+static void dary_clear(PQ* pq) {
+    for (int i = 0; i < pq->size; i++) pq->pos[pq->val[i]] = -1;
+    pq->size = 0;
+}
+
+#define DARY_DEFINE_OPS(D)                                                        \
+    static PQHandle* dary##D##_insert(PQ* pq, long long key, int value) {        \
+        return dary_insert(pq, key, value, D);                                   \
+    }                                                                            \
+    static PQItem dary##D##_extract_min(PQ* pq) {                                \
+        return dary_extract_min(pq, D);                                          \
+    }                                                                            \
+    static void dary##D##_decrease_key(PQ* pq, PQHandle* h, long long new_key) { \
+        dary_decrease_key(pq, h, new_key, D);                                    \
+    }                                                                            \
+    static void dary##D##_build(PQ* pq, const PQItem* items, int count,         \
+                                PQHandle** handles) {                            \
+        dary_build(pq, items, count, handles, D);                                \
+    }                                                                            \
+    const PQOps DARY##D##_OPS = {                                                \
+        .create = dary_create,                                                   \
+        .destroy = dary_destroy,                                                 \
+        .insert = dary##D##_insert,                                              \
+        .extract_min = dary##D##_extract_min,                                    \
+        .decrease_key = dary##D##_decrease_key,                                  \
+        .build = dary##D##_build,                                                \
+        .is_empty = dary_is_empty,                                               \
+        .clear = dary_clear                                                      \
+    };
+
+DARY_DEFINE_OPS(2)
+DARY_DEFINE_OPS(4)
+DARY_DEFINE_OPS(8)
@@ -0,0 +1,16 @@
+// dary_pq.h
+#ifndef DARY_PQ_H
+#define DARY_PQ_H
+
+#include "pq.h"
+
+// Indexed d-ary heap keyed by vertex id: values must lie in [0, capacity).
+// Keys/values are kept in flat arrays with a vertex -> slot position index,
+// so nothing is allocated after create. Arity is fixed at compile time.
+// One entry per vertex: inserting a vertex that is already queued keeps the
+// smaller key (see PQ_HANDLE_FROM_VERTEX).
+extern const PQOps DARY2_OPS;
+extern const PQOps DARY4_OPS;
+extern const PQOps DARY8_OPS;
+
+#endif
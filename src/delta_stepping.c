@@ -0,0 +1,228 @@
+// delta_stepping.c
+#include "delta_stepping.h"
+#include "binheap_pq.h"
+#include "sssp_tree.h"
+#include "thread_team.h"
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#define INF (LLONG_MAX/4)
+
+#define DS_DEFAULT_MIN_PARALLEL_N 4096
+#define DS_PARALLEL_CUTOFF 256 // phases with fewer items run on the calling thread
+
+enum { PHASE_LIGHT, PHASE_HEAVY };
+
+typedef struct {
+    int* data;
+    int size;
+    int cap;
+} IntVec;
+
+static void vec_push(IntVec* v, int x) {
+    if (v->size == v->cap) {
+        v->cap = v->cap ? v->cap * 2 : 64;
+        v->data = (int*)realloc(v->data, sizeof(int) * (size_t)v->cap);
+    }
+    v->data[v->size++] = x;
+}
+
+typedef struct {
+    const CSRGraph* g;
+    long long delta;
+    int threads;
+    long long* dist;
+    int* parent;
+
+    // Circular bucket window: bucket b lives in slot b % nslots. Every
+    // relaxation out of bucket cur lands below cur + nslots, so slots never alias.
+    IntVec* slots;
+    int nslots;
+    long long* queued_in; // bucket id v was last pushed to (dedupe), -1 if none
+
+    long long cur;        // bucket being settled
+    int* items;           // work list of the current phase
+    int item_count;
+    int phase;
+
+    IntVec* pending;      // per thread: vertices whose dist dropped this phase
+    ThreadTeam* team;
+} DSState;
+
+static int ds_relax(DSState* st, int v, long long nd) {
+    long long old = __atomic_load_n(&st->dist[v], __ATOMIC_RELAXED);
+    while (nd < old) {
+        if (__atomic_compare_exchange_n(&st->dist[v], &old, nd, 1,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            return 1;
+    }
+    return 0;
+}
+
+// Processes this thread's block of st->items for the current phase.
+static void ds_work(void* ctx, int tid, int nthreads) {
+    DSState* st = (DSState*)ctx;
+    const int* off = st->g->offsets;
+    const int* to = st->g->targets;
+    const int* wt = st->g->weights;
+    long long delta = st->delta;
+
+    int lo, hi;
+    team_block(st->item_count, tid, nthreads, &lo, &hi);
+    IntVec* out = &st->pending[tid];
+
+    for (int i = lo; i < hi; i++) {
+        int u = st->items[i];
+        long long du = __atomic_load_n(&st->dist[u], __ATOMIC_RELAXED);
+        int light = st->phase == PHASE_LIGHT;
+        if (light && du / delta != st->cur) continue; // stale entry
+
+        for (int k = off[u]; k < off[u + 1]; k++) {
+            if ((wt[k] <= delta) != light) continue;
+            int v = to[k];
+            if (ds_relax(st, v, du + wt[k])) vec_push(out, v);
+        }
+    }
+}
+
+// Runs the current phase on all threads (or just the caller for small phases).
+static void ds_run_phase(DSState* st, int phase) {
+    st->phase = phase;
+    if (st->item_count < DS_PARALLEL_CUTOFF) ds_work(st, 0, 1);
+    else team_run(st->team, ds_work, st);
+}
+
+static void ds_bucket_push(DSState* st, int v, long long b) {
+    if (st->queued_in[v] == b) return;
+    st->queued_in[v] = b;
+    vec_push(&st->slots[b % st->nslots], v);
+}
+
+void delta_stepping_default_config(DeltaSteppingConfig* cfg) {
+    cfg->delta = 0;
+    cfg->num_threads = 1;
+    cfg->min_parallel_n = DS_DEFAULT_MIN_PARALLEL_N;
+    cfg->fallback_ops = NULL;
+}
+
+DijkstraResult delta_stepping_run(const CSRGraph* g, int source, const DeltaSteppingConfig* cfg) {
+    int n = g->n;
+    if (n < cfg->min_parallel_n)
+        return dijkstra_run_csr(g, source, cfg->fallback_ops ? cfg->fallback_ops : &BINHEAP_OPS);
+
+    long long max_w = 0, sum_w = 0;
+    for (int k = 0; k < g->m; k++) {
+        if (g->weights[k] > max_w) max_w = g->weights[k];
+        sum_w += g->weights[k];
+    }
+
+    DSState st;
+    st.g = g;
+    st.delta = cfg->delta > 0 ? cfg->delta : (g->m ? sum_w / g->m : 1);
+    if (st.delta < 1) st.delta = 1;
+    st.threads = cfg->num_threads > 0 ? cfg->num_threads : 1;
+    st.dist = (long long*)malloc(sizeof(long long) * n);
+    st.parent = (int*)malloc(sizeof(int) * n);
+    st.queued_in = (long long*)malloc(sizeof(long long) * n);
+    st.items = (int*)malloc(sizeof(int) * n);
+    st.nslots = (int)(max_w / st.delta) + 2;
+    st.slots = (IntVec*)calloc((size_t)st.nslots, sizeof(IntVec));
+    st.pending = (IntVec*)calloc((size_t)st.threads, sizeof(IntVec));
+
+    // Per-vertex bucket stamps: already in this bucket's removed set / next frontier
+    long long* in_removed = (long long*)malloc(sizeof(long long) * n);
+    long long* in_next = (long long*)malloc(sizeof(long long) * n);
+    IntVec removed = { NULL, 0, 0 }; // vertices settled in bucket cur
+
+    for (int i = 0; i < n; i++) {
+        st.dist[i] = INF;
+        st.parent[i] = -1;
+        st.queued_in[i] = -1;
+        in_removed[i] = -1;
+        in_next[i] = -1;
+    }
+    st.dist[source] = 0;
+    ds_bucket_push(&st, source, 0);
+
+    st.team = team_create(st.threads);
+
+    st.cur = 0;
+    for (;;) {
+        // Find the next non-empty bucket within the window
+        long long b = st.cur;
+        while (b < st.cur + st.nslots && st.slots[b % st.nslots].size == 0) b++;
+        if (b == st.cur + st.nslots) break;
+        st.cur = b;
+
+        IntVec* slot = &st.slots[b % st.nslots];
+        st.item_count = 0;
+        for (int i = 0; i < slot->size; i++) {
+            int v = slot->data[i];
+            if (st.queued_in[v] == b) st.queued_in[v] = -1;
+            if (st.dist[v] / st.delta == b) st.items[st.item_count++] = v; // else stale
+        }
+        slot->size = 0;
+        removed.size = 0;
+
+        // Light edges may refill the current bucket: iterate until it stays empty
+        while (st.item_count > 0) {
+            for (int i = 0; i < st.item_count; i++) {
+                int v = st.items[i];
+                if (in_removed[v] != b) { in_removed[v] = b; vec_push(&removed, v); }
+            }
+            ds_run_phase(&st, PHASE_LIGHT);
+
+            st.item_count = 0;
+            for (int t = 0; t < st.threads; t++) {
+                IntVec* p = &st.pending[t];
+                for (int i = 0; i < p->size; i++) {
+                    int v = p->data[i];
+                    long long vb = st.dist[v] / st.delta;
+                    if (vb == b) {
+                        // Re-relax even if already removed: its distance dropped
+                        if (in_next[v] != b) {
+                            in_next[v] = b;
+                            st.items[st.item_count++] = v;
+                        }
+                    } else {
+                        ds_bucket_push(&st, v, vb);
+                    }
+                }
+                p->size = 0;
+            }
+            for (int i = 0; i < st.item_count; i++) in_next[st.items[i]] = -1;
+        }
+
+        // Heavy edges of everything settled in this bucket, once
+        memcpy(st.items, removed.data, sizeof(int) * (size_t)removed.size);
+        st.item_count = removed.size;
+        ds_run_phase(&st, PHASE_HEAVY);
+        for (int t = 0; t < st.threads; t++) {
+            IntVec* p = &st.pending[t];
+            for (int i = 0; i < p->size; i++) {
+                int v = p->data[i];
+                ds_bucket_push(&st, v, st.dist[v] / st.delta);
+            }
+            p->size = 0;
+        }
+        st.cur = b + 1;
+    }
+
+    sssp_tree_parents(g, source, st.dist, st.parent, st.team);
+
+    team_destroy(st.team);
+
+    for (int s = 0; s < st.nslots; s++) free(st.slots[s].data);
+    for (int t = 0; t < st.threads; t++) free(st.pending[t].data);
+    free(st.slots);
+    free(st.pending);
+    free(st.queued_in);
+    free(st.items);
+    free(in_removed);
+    free(in_next);
+    free(removed.data);
+
+    DijkstraResult r = { st.dist, st.parent };
+    return r;
+}
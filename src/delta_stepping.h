@@ -0,0 +1,23 @@
+// delta_stepping.h
+#ifndef DELTA_STEPPING_H
+#define DELTA_STEPPING_H
+
+#include "csr_graph.h"
+#include "dijkstra.h"
+#include "pq.h"
+
+typedef struct {
+    long long delta;           // bucket width; <= 0 picks the mean edge weight
+    int num_threads;           // worker threads including the caller (>= 1)
+    int min_parallel_n;        // smaller graphs run sequential Dijkstra instead
+    const PQOps* fallback_ops; // heap for the sequential fallback (NULL: binary heap)
+} DeltaSteppingConfig;
+
+void delta_stepping_default_config(DeltaSteppingConfig* cfg);
+
+// Parallel delta-stepping SSSP (pthreads) over a CSR graph with non-negative
+// weights. Returns the same DijkstraResult as dijkstra_run; free it with
+// dijkstra_free. parent[v] is some predecessor on a shortest path.
+DijkstraResult delta_stepping_run(const CSRGraph* g, int source, const DeltaSteppingConfig* cfg);
+
+#endif
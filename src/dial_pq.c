@@ -0,0 +1,229 @@
+// dial_pq.c
+#include "dial_pq.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <limits.h>
+
+#define DIAL_INIT_BUCKETS 64
+#define DIAL_MAX_BUCKETS  (1 << 16) // wider key spans go to the overflow list
+#define DIAL_OVERFLOW     (-2)      // slot marker for overflow items
+
+struct PQ {
+    int cap;
+    int size;
+    int in_buckets;      // items currently in the circular buckets
+    long long cur;       // cursor: all bucket keys lie in [cur, cur + nb)
+    int nb;              // number of buckets (power of two)
+    int* head;           // head[key & (nb-1)]
+    int over_head;       // overflow list (keys >= cur + nb)
+    long long over_min;  // lower bound on overflow keys
+    long long* key;      // key[v]
+    int* slot;           // slot[v]: bucket, DIAL_OVERFLOW, or -1 if not in heap
+    int* next;
+    int* prev;
+};
+
+static int* dial_head_of(PQ* pq, int slot) {
+    return slot == DIAL_OVERFLOW ? &pq->over_head : &pq->head[slot];
+}
+
+static void dial_link(PQ* pq, int v, int slot) {
+    int* head = dial_head_of(pq, slot);
+    pq->slot[v] = slot;
+    pq->prev[v] = -1;
+    pq->next[v] = *head;
+    if (*head >= 0) pq->prev[*head] = v;
+    *head = v;
+    if (slot == DIAL_OVERFLOW) {
+        if (pq->key[v] < pq->over_min) pq->over_min = pq->key[v];
+    } else {
+        pq->in_buckets++;
+    }
+}
+
+static void dial_unlink(PQ* pq, int v) {
+    int slot = pq->slot[v];
+    if (pq->prev[v] >= 0) pq->next[pq->prev[v]] = pq->next[v];
+    else *dial_head_of(pq, slot) = pq->next[v];
+    if (pq->next[v] >= 0) pq->prev[pq->next[v]] = pq->prev[v];
+    pq->slot[v] = -1;
+    if (slot != DIAL_OVERFLOW) pq->in_buckets--;
+}
+
+// Re-places every item (buckets and overflow) after `nb` or `cur` changed.
+static void dial_rebuild(PQ* pq, int new_nb);
+
+static void dial_place(PQ* pq, int v) {
+    long long d = pq->key[v] - pq->cur;
+    if (d >= pq->nb && d < DIAL_MAX_BUCKETS) {
+        int nb = pq->nb;
+        while (nb <= d) nb *= 2;
+        dial_rebuild(pq, nb);
+    }
+    if (d < pq->nb) dial_link(pq, v, (int)(pq->key[v] & (pq->nb - 1)));
+    else dial_link(pq, v, DIAL_OVERFLOW);
+}
+
+static void dial_rebuild(PQ* pq, int new_nb) {
+    // Chain every queued item into one temporary list through `next`
+    int all = -1;
+    for (int s = 0; s < pq->nb; s++) {
+        int v = pq->head[s];
+        while (v >= 0) { int nxt = pq->next[v]; pq->next[v] = all; all = v; v = nxt; }
+    }
+    int v = pq->over_head;
+    while (v >= 0) { int nxt = pq->next[v]; pq->next[v] = all; all = v; v = nxt; }
+
+    if (new_nb != pq->nb) {
+        pq->nb = new_nb;
+        pq->head = (int*)realloc(pq->head, sizeof(int) * (size_t)new_nb);
+    }
+    for (int s = 0; s < pq->nb; s++) pq->head[s] = -1;
+    pq->over_head = -1;
+    pq->over_min = LLONG_MAX;
+    pq->in_buckets = 0;
+
+    while (all >= 0) {
+        int nxt = pq->next[all];
+        long long d = pq->key[all] - pq->cur;
+        dial_link(pq, all, d < pq->nb ? (int)(pq->key[all] & (pq->nb - 1)) : DIAL_OVERFLOW);
+        all = nxt;
+    }
+}
+
+static void dial_check(const PQ* pq, int v, long long key) {
+    if (v < 0 || v >= pq->cap) {
+        fprintf(stderr, "dial queue: vertex %d outside capacity %d\n", v, pq->cap);
+        exit(1);
+    }
+    if (key < pq->cur) {
+        fprintf(stderr, "dial queue: key %lld is below current minimum %lld "
+                        "(non-monotone workload such as Prim is not supported)\n",
+                key, pq->cur);
+        exit(1);
+    }
+}
+
+static PQ* dial_create(int capacity) {
+    PQ* pq = (PQ*)malloc(sizeof(PQ));
+    pq->cap = capacity > 0 ? capacity : 1;
+    pq->size = 0;
+    pq->in_buckets = 0;
+    pq->cur = 0;
+    pq->nb = DIAL_INIT_BUCKETS;
+    pq->head = (int*)malloc(sizeof(int) * (size_t)pq->nb);
+    for (int s = 0; s < pq->nb; s++) pq->head[s] = -1;
+    pq->over_head = -1;
+    pq->over_min = LLONG_MAX;
+    pq->key = (long long*)malloc(sizeof(long long) * pq->cap);
+    pq->slot = (int*)malloc(sizeof(int) * pq->cap);
+    pq->next = (int*)malloc(sizeof(int) * pq->cap);
+    pq->prev = (int*)malloc(sizeof(int) * pq->cap);
+    for (int v = 0; v < pq->cap; v++) pq->slot[v] = -1;
+    return pq;
+}
+
+static void dial_destroy(PQ* pq) {
+    free(pq->head);
+    free(pq->key);
+    free(pq->slot);
+    free(pq->next);
+    free(pq->prev);
+    free(pq);
+}
+
+static PQHandle* dial_insert(PQ* pq, long long key, int value) {
+    dial_check(pq, value, key);
+    if (pq->slot[value] != -1) {
+        // Already queued: keep the smaller key
+        if (key >= pq->key[value]) return PQ_HANDLE_FROM_VERTEX(value);
+        dial_unlink(pq, value);
+    } else {
+        pq->size++;
+    }
+    pq->key[value] = key;
+    dial_place(pq, value);
+    return PQ_HANDLE_FROM_VERTEX(value);
+}
+
+static PQItem dial_extract_min(PQ* pq) {
+    if (pq->size == 0) {
+        fprintf(stderr, "extract_min on empty heap\n");
+        exit(1);
+    }
+    if (pq->in_buckets == 0) {
+        // Only far-away keys left: jump the cursor to the smallest one
+        long long mn = pq->key[pq->over_head];
+        for (int v = pq->over_head; v >= 0; v = pq->next[v])
+            if (pq->key[v] < mn) mn = pq->key[v];
+        pq->cur = mn;
+        dial_rebuild(pq, pq->nb);
+    }
+
+    int mask = pq->nb - 1;
+    while (pq->head[pq->cur & mask] < 0) {
+        pq->cur++;
+        // Keep overflow keys outside the window as it slides
+        if (pq->over_head >= 0 && pq->over_min < pq->cur + pq->nb)
+            dial_rebuild(pq, pq->nb);
+    }
+
+    int u = pq->head[pq->cur & mask];
+    dial_unlink(pq, u);
+    pq->size--;
+
+    PQItem out = { pq->key[u], u };
+    return out;
+}
+
+static void dial_decrease_key(PQ* pq, PQHandle* h, long long new_key) {
+    int v = PQ_HANDLE_TO_VERTEX(h);
+    dial_check(pq, v, new_key);
+    if (pq->slot[v] == -1) {
+        fprintf(stderr, "decrease_key on vertex %d not in heap\n", v);
+        exit(1);
+    }
+    if (new_key > pq->key[v]) {
+        fprintf(stderr, "decrease_key called with larger key\n");
+        exit(1);
+    }
+    dial_unlink(pq, v);
+    pq->key[v] = new_key;
+    dial_place(pq, v);
+}
+
+// Inserts are O(1) here, so a batch is just a loop
+static void dial_build(PQ* pq, const PQItem* items, int count, PQHandle** handles) {
+    for (int i = 0; i < count; i++) {
+        PQHandle* h = dial_insert(pq, items[i].key, items[i].value);
+        if (handles) handles[i] = h;
+    }
+}
+
+static int dial_is_empty(PQ* pq) {
+    return pq->size == 0;
+}
+
+static void dial_clear(PQ* pq) {
+    for (int s = 0; s < pq->nb; s++) {
+        for (int v = pq->head[s]; v >= 0; v = pq->next[v]) pq->slot[v] = -1;
+        pq->head[s] = -1;
+    }
+    for (int v = pq->over_head; v >= 0; v = pq->next[v]) pq->slot[v] = -1;
+    pq->over_head = -1;
+    pq->over_min = LLONG_MAX;
+    pq->size = 0;
+    pq->in_buckets = 0;
+    pq->cur = 0;
+}
+
+const PQOps DIAL_OPS = {
+    .create = dial_create,
+    .destroy = dial_destroy,
+    .insert = dial_insert,
+    .extract_min = dial_extract_min,
+    .decrease_key = dial_decrease_key,
+    .build = dial_build,
+    .is_empty = dial_is_empty,
+    .clear = dial_clear
+};
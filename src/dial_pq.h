@@ -0,0 +1,15 @@
+// dial_pq.h
+#ifndef DIAL_PQ_H
+#define DIAL_PQ_H
+
+#include "pq.h"
+
+// Dial's bucket queue keyed by vertex id (values in [0, capacity)).
+// A circular array of buckets, one per key value, covers the window
+// [cursor, cursor + buckets); keys further out wait in an overflow list.
+// Best for small integer weights. Same monotonicity rule as RADIX_OPS:
+// non-monotone use (e.g. prim_run) prints an error and exits. Also like
+// RADIX_OPS, a repeated insert of a queued vertex keeps the smaller key.
+extern const PQOps DIAL_OPS;
+
+#endif
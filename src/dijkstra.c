@@ -1,24 +1,22 @@
 // src/dijkstra.c
 #include "dijkstra.h"
+#include "lazy_heap.h"
 #include <stdlib.h>
 #include <limits.h>
 
 #define INF (LLONG_MAX/4)
 
-DijkstraResult dijkstra_run(const Graph* g, int s, const PQOps* ops) {
+// Core loop over caller-provided buffers. pq must be empty; it is left empty.
+static void dijkstra_core(const Graph* g, int s, const PQOps* ops, PQ* pq,
+                          long long* dist, int* parent, PQHandle** handle) {
     int n = g->n;
-    long long* dist = (long long*)malloc(sizeof(long long) * n);
-    int* parent = (int*)malloc(sizeof(int) * n);
-    PQHandle** handle = (PQHandle**)calloc((size_t)n, sizeof(PQHandle*)); // NULL init
-
     for (int i = 0; i < n; i++) {
         dist[i] = INF;
         parent[i] = -1;
+        handle[i] = NULL;
     }
     dist[s] = 0;
 
-    PQ* pq = ops->create(n);
-
     // Insert ONLY the source to start (lazy insertion)
     handle[s] = ops->insert(pq, dist[s], s);
 
@@ -46,7 +44,16 @@ DijkstraResult dijkstra_run(const Graph* g, int s, const PQOps* ops) {
             }
         }
     }
+}
 
+DijkstraResult dijkstra_run(const Graph* g, int s, const PQOps* ops) {
+    int n = g->n;
+    long long* dist = (long long*)malloc(sizeof(long long) * n);
+    int* parent = (int*)malloc(sizeof(int) * n);
+    PQHandle** handle = (PQHandle**)malloc(sizeof(PQHandle*) * n);
+
+    PQ* pq = pq_create(ops, n);
+    dijkstra_core(g, s, ops, pq, dist, parent, handle);
     ops->destroy(pq);
     free(handle);
 
@@ -54,6 +61,176 @@ DijkstraResult dijkstra_run(const Graph* g, int s, const PQOps* ops) {
     return r;
 }
 
+void dijkstra_workspace_init(DijkstraWorkspace* ws, int n, const PQOps* ops) {
+    ws->n = n;
+    ws->ops = ops;
+    ws->dist = (long long*)malloc(sizeof(long long) * n);
+    ws->parent = (int*)malloc(sizeof(int) * n);
+    ws->handle = (PQHandle**)malloc(sizeof(PQHandle*) * n);
+    ws->pq = pq_create(ops, n);
+}
+
+void dijkstra_workspace_free(DijkstraWorkspace* ws) {
+    ws->ops->destroy(ws->pq);
+    free(ws->dist);
+    free(ws->parent);
+    free(ws->handle);
+}
+
+void dijkstra_run_ws(const Graph* g, int s, DijkstraWorkspace* ws) {
+    ws->ops->clear(ws->pq);
+    dijkstra_core(g, s, ws->ops, ws->pq, ws->dist, ws->parent, ws->handle);
+}
+
+// Same algorithm over the frozen CSR layout: edges of u are contiguous.
+DijkstraResult dijkstra_run_csr(const CSRGraph* g, int s, const PQOps* ops) {
+    int n = g->n;
+    long long* dist = (long long*)malloc(sizeof(long long) * n);
+    int* parent = (int*)malloc(sizeof(int) * n);
+    PQHandle** handle = (PQHandle**)calloc((size_t)n, sizeof(PQHandle*));
+
+    for (int i = 0; i < n; i++) {
+        dist[i] = INF;
+        parent[i] = -1;
+    }
+    dist[s] = 0;
+
+    PQ* pq = pq_create(ops, n);
+    handle[s] = ops->insert(pq, dist[s], s);
+
+    const int* off = g->offsets;
+    const int* to = g->targets;
+    const int* wt = g->weights;
+
+    while (!ops->is_empty(pq)) {
+        PQItem it = ops->extract_min(pq);
+        int u = it.value;
+        long long du = it.key;
+
+        if (du != dist[u]) continue;
+
+        for (int k = off[u]; k < off[u + 1]; k++) {
+            int v = to[k];
+            long long nd = du + wt[k];
+
+            if (nd < dist[v]) {
+                dist[v] = nd;
+                parent[v] = u;
+
+                if (handle[v] == NULL) {
+                    handle[v] = ops->insert(pq, nd, v);
+                } else {
+                    ops->decrease_key(pq, handle[v], nd);
+                }
+            }
+        }
+    }
+
+    ops->destroy(pq);
+    free(handle);
+
+    DijkstraResult r = { dist, parent };
+    return r;
+}
+
+// Lazy insertion: each improvement queues a new (dist, v) entry instead of a
+// decrease-key; entries whose key no longer matches dist are skipped on pop.
+DijkstraResult dijkstra_run_lazy(const Graph* g, int s, const PQOps* ops) {
+    int n = g->n;
+    long long* dist = (long long*)malloc(sizeof(long long) * n);
+    int* parent = (int*)malloc(sizeof(int) * n);
+    for (int i = 0; i < n; i++) {
+        dist[i] = INF;
+        parent[i] = -1;
+    }
+    dist[s] = 0;
+
+    LazyHeap lh;
+    PQ* pq = NULL;
+    if (ops) {
+        pq = pq_create(ops, n);
+        ops->insert(pq, 0, s);
+    } else {
+        lazy_heap_init(&lh, n);
+        lazy_heap_push(&lh, 0, s);
+    }
+
+    while (ops ? !ops->is_empty(pq) : lh.size > 0) {
+        PQItem it = ops ? ops->extract_min(pq) : lazy_heap_pop(&lh);
+        int u = it.value;
+        long long du = it.key;
+
+        if (du != dist[u]) continue;
+
+        for (Edge* e = g->adj[u]; e; e = e->next) {
+            int v = e->to;
+            long long nd = du + e->w;
+            if (nd < dist[v]) {
+                dist[v] = nd;
+                parent[v] = u;
+                if (ops) ops->insert(pq, nd, v);
+                else lazy_heap_push(&lh, nd, v);
+            }
+        }
+    }
+
+    if (ops) ops->destroy(pq);
+    else lazy_heap_free(&lh);
+
+    DijkstraResult r = { dist, parent };
+    return r;
+}
+
+DijkstraResult dijkstra_run_lazy_csr(const CSRGraph* g, int s, const PQOps* ops) {
+    int n = g->n;
+    long long* dist = (long long*)malloc(sizeof(long long) * n);
+    int* parent = (int*)malloc(sizeof(int) * n);
+    for (int i = 0; i < n; i++) {
+        dist[i] = INF;
+        parent[i] = -1;
+    }
+    dist[s] = 0;
+
+    LazyHeap lh;
+    PQ* pq = NULL;
+    if (ops) {
+        pq = pq_create(ops, n);
+        ops->insert(pq, 0, s);
+    } else {
+        lazy_heap_init(&lh, n);
+        lazy_heap_push(&lh, 0, s);
+    }
+
+    const int* off = g->offsets;
+    const int* to = g->targets;
+    const int* wt = g->weights;
+
+    while (ops ? !ops->is_empty(pq) : lh.size > 0) {
+        PQItem it = ops ? ops->extract_min(pq) : lazy_heap_pop(&lh);
+        int u = it.value;
+        long long du = it.key;
+
+        if (du != dist[u]) continue;
+
+        for (int k = off[u]; k < off[u + 1]; k++) {
+            int v = to[k];
+            long long nd = du + wt[k];
+            if (nd < dist[v]) {
+                dist[v] = nd;
+                parent[v] = u;
+                if (ops) ops->insert(pq, nd, v);
+                else lazy_heap_push(&lh, nd, v);
+            }
+        }
+    }
+
+    if (ops) ops->destroy(pq);
+    else lazy_heap_free(&lh);
+
+    DijkstraResult r = { dist, parent };
+    return r;
+}
+
 void dijkstra_free(DijkstraResult r) {
     free(r.dist);
     free(r.parent);
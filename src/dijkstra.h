@@ -3,7 +3,12 @@
 #define DIJKSTRA_H
 
 #include "graph.h"
+#include "csr_graph.h"
 #include "pq.h"
+#include <limits.h>
+
+// Distance reported for unreachable vertices
+#define DIJKSTRA_INF (LLONG_MAX/4)
 
 typedef struct {
     long long* dist;
@@ -11,6 +16,32 @@ typedef struct {
 } DijkstraResult;
 
 DijkstraResult dijkstra_run(const Graph* g, int source, const PQOps* ops);
+DijkstraResult dijkstra_run_csr(const CSRGraph* g, int source, const PQOps* ops);
+
+// Lazy-insertion mode: no decrease-key. Every improvement inserts a new entry
+// and stale pops are skipped, so the heap may hold up to m entries. ops NULL
+// uses a compact insert-only heap without handles (lazy_heap.h); otherwise
+// ops->insert is called and its handle ignored (node-based heaps keep the
+// duplicates, vertex-indexed ones keep the smaller key).
+DijkstraResult dijkstra_run_lazy(const Graph* g, int source, const PQOps* ops);
+DijkstraResult dijkstra_run_lazy_csr(const CSRGraph* g, int source, const PQOps* ops);
+
 void dijkstra_free(DijkstraResult r);
 
+// Reusable buffers and heap for repeated single-source runs on graphs with n
+// vertices. dijkstra_run_ws writes into ws->dist / ws->parent and allocates
+// nothing itself; the heap is cleared and reused between runs.
+typedef struct {
+    int n;
+    long long* dist;
+    int* parent;
+    PQHandle** handle;
+    const PQOps* ops;
+    PQ* pq;
+} DijkstraWorkspace;
+
+void dijkstra_workspace_init(DijkstraWorkspace* ws, int n, const PQOps* ops);
+void dijkstra_workspace_free(DijkstraWorkspace* ws);
+void dijkstra_run_ws(const Graph* g, int source, DijkstraWorkspace* ws);
+
 #endif
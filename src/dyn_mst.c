@@ -0,0 +1,277 @@
+// dyn_mst.c
+#include "dyn_mst.h"
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Link-cut tree nodes: 0..n-1 are vertices, n..2n-2 tree edges. Splay trees
+// over preferred paths; p is the splay parent or, at a splay root, the path
+// parent. mx is the node with the largest val in the splay subtree.
+typedef struct {
+    int ch[2];
+    int p;
+    int rev;   // children still to be swapped (path reversed by make_root)
+    int mx;
+} LCNode;
+
+struct DynMST {
+    int n;
+    LCNode* nd;
+    long long* val;  // edge weight; LLONG_MIN for vertex nodes
+    int* eu;         // endpoints of edge node n + i
+    int* ev;
+    int* free_edges; // unused edge node ids (stack)
+    int free_count;
+    int* stack;      // splay scratch
+    long long weight;
+};
+
+static int is_splay_root(const DynMST* t, int x) {
+    int p = t->nd[x].p;
+    return p < 0 || (t->nd[p].ch[0] != x && t->nd[p].ch[1] != x);
+}
+
+static void pull(DynMST* t, int x) {
+    LCNode* a = &t->nd[x];
+    a->mx = x;
+    for (int k = 0; k < 2; k++) {
+        int c = a->ch[k];
+        if (c >= 0 && t->val[t->nd[c].mx] > t->val[a->mx]) a->mx = t->nd[c].mx;
+    }
+}
+
+static void push(DynMST* t, int x) {
+    LCNode* a = &t->nd[x];
+    if (!a->rev) return;
+    int c = a->ch[0];
+    a->ch[0] = a->ch[1];
+    a->ch[1] = c;
+    if (a->ch[0] >= 0) t->nd[a->ch[0]].rev ^= 1;
+    if (a->ch[1] >= 0) t->nd[a->ch[1]].rev ^= 1;
+    a->rev = 0;
+}
+
+static void rotate(DynMST* t, int x) {
+    int p = t->nd[x].p, g = t->nd[p].p;
+    int dir = t->nd[p].ch[1] == x;
+    int b = t->nd[x].ch[!dir];
+
+    if (!is_splay_root(t, p)) t->nd[g].ch[t->nd[g].ch[1] == p] = x;
+    t->nd[x].p = g;
+    t->nd[x].ch[!dir] = p;
+    t->nd[p].p = x;
+    t->nd[p].ch[dir] = b;
+    if (b >= 0) t->nd[b].p = p;
+    pull(t, p);
+    pull(t, x);
+}
+
+static void splay(DynMST* t, int x) {
+    // Pending reversals are pushed top-down along the splay path first
+    int depth = 0;
+    for (int y = x; ; y = t->nd[y].p) {
+        t->stack[depth++] = y;
+        if (is_splay_root(t, y)) break;
+    }
+    while (depth > 0) push(t, t->stack[--depth]);
+
+    while (!is_splay_root(t, x)) {
+        int p = t->nd[x].p;
+        if (!is_splay_root(t, p)) {
+            int g = t->nd[p].p;
+            int zigzig = (t->nd[g].ch[1] == p) == (t->nd[p].ch[1] == x);
+            rotate(t, zigzig ? p : x);
+        }
+        rotate(t, x);
+    }
+}
+
+// Makes the root-to-x path preferred; x ends as the root of its splay tree
+static void access(DynMST* t, int x) {
+    for (int last = -1, y = x; y >= 0; last = y, y = t->nd[y].p) {
+        splay(t, y);
+        t->nd[y].ch[1] = last;
+        pull(t, y);
+    }
+    splay(t, x);
+}
+
+static void make_root(DynMST* t, int x) {
+    access(t, x);
+    t->nd[x].rev ^= 1;
+}
+
+static int find_root(DynMST* t, int x) {
+    access(t, x);
+    for (;;) {
+        push(t, x);
+        if (t->nd[x].ch[0] < 0) break;
+        x = t->nd[x].ch[0];
+    }
+    splay(t, x);
+    return x;
+}
+
+static void lc_link(DynMST* t, int a, int b) {
+    make_root(t, a);
+    t->nd[a].p = b;
+}
+
+// a and b must be adjacent in the represented tree
+static void lc_cut(DynMST* t, int a, int b) {
+    make_root(t, a);
+    access(t, b);
+    int l = t->nd[b].ch[0];
+    t->nd[b].ch[0] = -1;
+    t->nd[l].p = -1;
+    pull(t, b);
+}
+
+static void add_tree_edge(DynMST* t, int u, int v, int w) {
+    int e = t->free_edges[--t->free_count];
+    t->val[e] = w;
+    t->nd[e].mx = e;
+    t->eu[e - t->n] = u;
+    t->ev[e - t->n] = v;
+    lc_link(t, u, e);
+    lc_link(t, e, v);
+    t->weight += w;
+}
+
+static void remove_tree_edge(DynMST* t, int e) {
+    lc_cut(t, t->eu[e - t->n], e);
+    lc_cut(t, e, t->ev[e - t->n]);
+    t->weight -= t->val[e];
+    t->eu[e - t->n] = -1;
+    t->free_edges[t->free_count++] = e;
+}
+
+DynMST* dyn_mst_create(const Graph* g, const PrimResult* r) {
+    int n = g->n;
+    int nodes = 2 * n - 1 > 0 ? 2 * n - 1 : 1;
+    DynMST* t = (DynMST*)malloc(sizeof(DynMST));
+    t->n = n;
+    t->nd = (LCNode*)malloc(sizeof(LCNode) * (size_t)nodes);
+    t->val = (long long*)malloc(sizeof(long long) * (size_t)nodes);
+    t->eu = (int*)malloc(sizeof(int) * (size_t)(n > 1 ? n - 1 : 1));
+    t->ev = (int*)malloc(sizeof(int) * (size_t)(n > 1 ? n - 1 : 1));
+    t->free_edges = (int*)malloc(sizeof(int) * (size_t)nodes);
+    t->stack = (int*)malloc(sizeof(int) * (size_t)nodes);
+    t->free_count = 0;
+    t->weight = 0;
+
+    for (int x = 0; x < nodes; x++) {
+        t->nd[x].ch[0] = t->nd[x].ch[1] = t->nd[x].p = -1;
+        t->nd[x].rev = 0;
+        t->nd[x].mx = x;
+        t->val[x] = LLONG_MIN;
+    }
+    for (int e = nodes - 1; e >= n; e--) {
+        t->eu[e - n] = -1;
+        t->free_edges[t->free_count++] = e;
+    }
+
+    for (int v = 0; v < n; v++) {
+        int p = r->parent[v];
+        if (p < 0) continue;
+        int w = 0, found = 0;
+        for (Edge* e = g->adj[v]; e; e = e->next) {
+            if (e->to == p && (!found || e->w < w)) {
+                w = e->w;
+                found = 1;
+            }
+        }
+        if (!found) {
+            fprintf(stderr, "dyn_mst: tree edge %d-%d is not in the graph\n", v, p);
+            exit(1);
+        }
+        add_tree_edge(t, v, p, w);
+    }
+    return t;
+}
+
+void dyn_mst_destroy(DynMST* t) {
+    free(t->nd);
+    free(t->val);
+    free(t->eu);
+    free(t->ev);
+    free(t->free_edges);
+    free(t->stack);
+    free(t);
+}
+
+int dyn_mst_insert(DynMST* t, int u, int v, int w) {
+    if (u < 0 || u >= t->n || v < 0 || v >= t->n) {
+        fprintf(stderr, "dyn_mst: edge %d-%d outside 0..%d\n", u, v, t->n - 1);
+        exit(1);
+    }
+    if (u == v) return 0;
+    if (find_root(t, u) != find_root(t, v)) {
+        add_tree_edge(t, u, v, w);
+        return 1;
+    }
+
+    // Cycle: the new edge belongs to the MST iff it beats the path maximum
+    make_root(t, u);
+    access(t, v);
+    int e = t->nd[v].mx;
+    if (t->val[e] <= w) return 0;
+    remove_tree_edge(t, e);
+    add_tree_edge(t, u, v, w);
+    return 1;
+}
+
+long long dyn_mst_weight(const DynMST* t) {
+    return t->weight;
+}
+
+PrimResult dyn_mst_result(const DynMST* t, int root) {
+    int n = t->n;
+    int edges = n > 1 ? n - 1 : 0;
+
+    // Forest adjacency (CSR over the live edge nodes)
+    int* off = (int*)calloc((size_t)n + 1, sizeof(int));
+    for (int i = 0; i < edges; i++) {
+        if (t->eu[i] < 0) continue;
+        off[t->eu[i] + 1]++;
+        off[t->ev[i] + 1]++;
+    }
+    for (int v = 0; v < n; v++) off[v + 1] += off[v];
+    int* adj = (int*)malloc(sizeof(int) * (size_t)(off[n] > 0 ? off[n] : 1));
+    int* fill = (int*)malloc(sizeof(int) * (size_t)(n > 0 ? n : 1));
+    for (int v = 0; v < n; v++) fill[v] = off[v];
+    for (int i = 0; i < edges; i++) {
+        if (t->eu[i] < 0) continue;
+        adj[fill[t->eu[i]]++] = t->ev[i];
+        adj[fill[t->ev[i]]++] = t->eu[i];
+    }
+
+    int* parent = (int*)malloc(sizeof(int) * (size_t)n);
+    char* seen = (char*)calloc((size_t)n, 1);
+    for (int v = 0; v < n; v++) parent[v] = -1;
+    int* queue = fill; // reused: BFS order
+    for (int i = -1; i < n; i++) {
+        int s = i < 0 ? root : i;
+        if (s < 0 || s >= n || seen[s]) continue;
+        int head = 0, tail = 0;
+        seen[s] = 1;
+        queue[tail++] = s;
+        while (head < tail) {
+            int u = queue[head++];
+            for (int k = off[u]; k < off[u + 1]; k++) {
+                int v = adj[k];
+                if (seen[v]) continue;
+                seen[v] = 1;
+                parent[v] = u;
+                queue[tail++] = v;
+            }
+        }
+    }
+
+    free(off);
+    free(adj);
+    free(fill);
+    free(seen);
+    PrimResult r = { t->weight, parent };
+    return r;
+}
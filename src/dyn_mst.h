@@ -0,0 +1,34 @@
+// dyn_mst.h
+#ifndef DYN_MST_H
+#define DYN_MST_H
+
+#include "graph.h"
+#include "prim.h"
+
+// Incremental minimum spanning forest under edge insertions. The forest is
+// kept in a link-cut tree where every tree edge is its own node carrying its
+// weight, so the heaviest edge on the u-v tree path is a path-max query.
+// Inserting u-v (weight w) links two trees, or replaces that heaviest edge
+// if it is heavier than w (cycle property). O(log n) amortized per insert.
+typedef struct DynMST DynMST;
+
+// Starts from r = prim_run(g, ...) (or any spanning forest of g given as a
+// parent array); tree edge weights are looked up in g. Vertices Prim did not
+// reach start as single-vertex trees. g is not referenced afterwards and
+// inserted edges are not added to it.
+DynMST*    dyn_mst_create(const Graph* g, const PrimResult* r);
+void       dyn_mst_destroy(DynMST* t);
+
+// Returns 1 if the forest changed (new link or replaced edge), 0 otherwise.
+int        dyn_mst_insert(DynMST* t, int u, int v, int w);
+
+// Total weight of the spanning forest (equals prim_run's mst_weight while
+// the graph is connected).
+long long  dyn_mst_weight(const DynMST* t);
+
+// Current forest as a PrimResult: parent[] rooted at root, other trees rooted
+// at their smallest vertex, mst_weight = dyn_mst_weight. O(n); free with
+// prim_free.
+PrimResult dyn_mst_result(const DynMST* t, int root);
+
+#endif
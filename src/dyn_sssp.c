@@ -0,0 +1,79 @@
+// dyn_sssp.c
+#include "dyn_sssp.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define INF DIJKSTRA_INF
+
+struct DynSSSP {
+    Graph* g;
+    DijkstraResult* r;
+    const PQOps* ops;
+    PQ* pq;
+    PQHandle** handle;  // non-NULL while the vertex is queued; all NULL between batches
+};
+
+DynSSSP* dyn_sssp_create(Graph* g, DijkstraResult* r, const PQOps* ops) {
+    DynSSSP* d = (DynSSSP*)malloc(sizeof(DynSSSP));
+    d->g = g;
+    d->r = r;
+    d->ops = ops;
+    d->pq = pq_create(ops, g->n);
+    d->handle = (PQHandle**)calloc((size_t)g->n, sizeof(PQHandle*));
+    return d;
+}
+
+void dyn_sssp_destroy(DynSSSP* d) {
+    d->ops->destroy(d->pq);
+    free(d->handle);
+    free(d);
+}
+
+// New tentative distance for v via u; queues or decreases v
+static void improve(DynSSSP* d, int u, int v, long long nd, DynSSSPStats* st) {
+    long long* dist = d->r->dist;
+    if (nd >= dist[v]) return;
+    dist[v] = nd;
+    d->r->parent[v] = u;
+    st->improvements++;
+    if (d->handle[v]) d->ops->decrease_key(d->pq, d->handle[v], nd);
+    else d->handle[v] = d->ops->insert(d->pq, nd, v);
+}
+
+void dyn_sssp_update(DynSSSP* d, const EdgeUpdate* updates, int count, DynSSSPStats* stats) {
+    DynSSSPStats st;
+    memset(&st, 0, sizeof(st));
+    Graph* g = d->g;
+    long long* dist = d->r->dist;
+    // The heap is empty here; clear resets the cursor of monotone queues,
+    // since this batch's keys may lie below the previous batch's
+    d->ops->clear(d->pq);
+
+    // Seed with every endpoint an update improves, before any extraction
+    for (int i = 0; i < count; i++) {
+        const EdgeUpdate* up = &updates[i];
+        if (up->u < 0 || up->u >= g->n || up->v < 0 || up->v >= g->n || up->w < 0) {
+            fprintf(stderr, "dyn_sssp: bad update %d-%d (w=%d)\n", up->u, up->v, up->w);
+            exit(1);
+        }
+        if (!graph_decrease_or_add_edge(g, up->u, up->v, up->w)) continue;
+        st.changed_edges++;
+        if (dist[up->u] < INF) improve(d, up->u, up->v, dist[up->u] + up->w, &st);
+        if (!g->directed && dist[up->v] < INF) improve(d, up->v, up->u, dist[up->v] + up->w, &st);
+    }
+
+    // Every vertex whose distance can still drop is reachable through a
+    // queued one, so plain Dijkstra from the queue settles the affected region
+    while (!d->ops->is_empty(d->pq)) {
+        PQItem it = d->ops->extract_min(d->pq);
+        int u = it.value;
+        d->handle[u] = NULL;
+        for (Edge* e = g->adj[u]; e; e = e->next) {
+            st.relaxed++;
+            improve(d, u, e->to, it.key + e->w, &st);
+        }
+    }
+
+    if (stats) *stats = st;
+}
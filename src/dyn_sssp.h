@@ -0,0 +1,35 @@
+// dyn_sssp.h
+#ifndef DYN_SSSP_H
+#define DYN_SSSP_H
+
+#include "graph.h"
+#include "dijkstra.h"
+#include "pq.h"
+
+// Incremental single-source shortest paths under edge insertions and weight
+// decreases. Distances can only drop, so a batch is repaired by seeding a
+// heap with the heads of improved edges and running Dijkstra from there:
+// only vertices whose distance actually changes are touched.
+typedef struct {
+    int u, v, w;   // edge u-v gets weight w (added, or lowered if heavier)
+} EdgeUpdate;
+
+typedef struct {
+    int changed_edges;   // updates that modified the graph
+    int improvements;    // distance decreases (a vertex may count more than once)
+    long long relaxed;   // arcs scanned during the repair
+} DynSSSPStats;
+
+typedef struct DynSSSP DynSSSP;
+
+// Maintains r (a dijkstra_run(g, ...) result on this graph, still owned by the
+// caller) in place while g is updated through dyn_sssp_update. Keeps a heap
+// and a handle array between batches, so a batch costs O(affected) only.
+DynSSSP* dyn_sssp_create(Graph* g, DijkstraResult* r, const PQOps* ops);
+void     dyn_sssp_destroy(DynSSSP* d);
+
+// Applies the updates to the graph (graph_decrease_or_add_edge) and repairs
+// dist/parent. stats may be NULL.
+void dyn_sssp_update(DynSSSP* d, const EdgeUpdate* updates, int count, DynSSSPStats* stats);
+
+#endif
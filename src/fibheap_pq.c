@@ -1,5 +1,6 @@
 // src/fibheap_pq.c
 #include "pq.h"
+#include "node_pool.h"
 #include <stdlib.h>
 #include <math.h>
 #include <stdio.h>
@@ -20,10 +21,11 @@ typedef struct FibNode {
 struct PQ {
     FibNode *min;
     int n;
+    NodePool pool; // node slabs, recycled on extract
 };
 
-static FibNode *fib_node_create(long long key, int value) {
-    FibNode *x = (FibNode *)malloc(sizeof(FibNode));
+static FibNode *fib_node_create(PQ *pq, long long key, int value) {
+    FibNode *x = (FibNode *)node_pool_alloc(&pq->pool);
     if (!x) return NULL;
 
     x->key = key;
@@ -195,26 +197,45 @@ static void fib_cascading_cut(PQ *pq, FibNode *y) {
 /* PQOps */
 
 static PQ *fibheap_create(int capacity) {
-    (void)capacity;
     PQ *pq = (PQ *)malloc(sizeof(PQ));
     if (!pq) return NULL;
     pq->min = NULL;
     pq->n = 0;
+    node_pool_init(&pq->pool, sizeof(FibNode), capacity);
     return pq;
 }
 
 static void fibheap_destroy(PQ *pq) {
+    // Remaining nodes live in the pool's slabs; no tree walk needed
+    node_pool_release(&pq->pool);
     free(pq);
 }
 
 static PQHandle *fibheap_insert(PQ *pq, long long key, int value) {
-    FibNode *x = fib_node_create(key, value);
+    FibNode *x = fib_node_create(pq, key, value);
     if (!x) return NULL;
     fib_add_root(pq, x);
     pq->n++;
     return (PQHandle *)x;
 }
 
+// Bulk build: every item becomes a root. O(count); the first extract_min's
+// consolidate pays for shaping the trees, as with repeated inserts.
+static void fibheap_build(PQ *pq, const PQItem *items, int count, PQHandle **handles) {
+    for (int i = 0; i < count; i++) {
+        FibNode *x = fib_node_create(pq, items[i].key, items[i].value);
+        if (!x) abort();
+        if (!pq->min) {
+            pq->min = x;
+        } else {
+            fib_splice_into_root_list(pq, x);
+            if (x->key < pq->min->key) pq->min = x;
+        }
+        if (handles) handles[i] = (PQHandle *)x;
+    }
+    pq->n += count;
+}
+
 static PQItem fibheap_extract_min(PQ *pq) {
     PQItem item = (PQItem){0, 0};
     FibNode *z = pq->min;
@@ -282,7 +303,7 @@ static PQItem fibheap_extract_min(PQ *pq) {
     }
 
     z->left = z->right = z;
-    free(z);
+    node_pool_free(&pq->pool, z);
     pq->n--;
 
     return item;
@@ -312,11 +333,19 @@ static int fibheap_is_empty(PQ *pq) {
     return pq->min == NULL;
 }
 
+static void fibheap_clear(PQ *pq) {
+    node_pool_reset(&pq->pool);
+    pq->min = NULL;
+    pq->n = 0;
+}
+
 PQOps fibheap_pq_ops = {
     .create       = fibheap_create,
     .destroy      = fibheap_destroy,
     .insert       = fibheap_insert,
     .extract_min  = fibheap_extract_min,
     .decrease_key = fibheap_decrease_key,
-    .is_empty     = fibheap_is_empty
+    .build        = fibheap_build,
+    .is_empty     = fibheap_is_empty,
+    .clear        = fibheap_clear
 };
@@ -23,6 +23,35 @@ void graph_add_edge(Graph* g, int u, int v, int w) {
     if (!g->directed) add_one(g, v, u, w);
 }
 
+void graph_add_arc(Graph* g, int u, int v, int w) {
+    add_one(g, u, v, w);
+}
+
+static int lower_one(Graph* g, int u, int v, int w) {
+    for (Edge* e = g->adj[u]; e; e = e->next) {
+        if (e->to != v) continue;
+        if (w >= e->w) return 0;
+        e->w = w;
+        return 1;
+    }
+    add_one(g, u, v, w);
+    return 1;
+}
+
+int graph_decrease_or_add_edge(Graph* g, int u, int v, int w) {
+    int changed = lower_one(g, u, v, w);
+    if (!g->directed) changed |= lower_one(g, v, u, w);
+    return changed;
+}
+
+Graph* graph_reverse(const Graph* g) {
+    Graph* r = graph_create(g->n, g->directed);
+    for (int u = 0; u < g->n; u++)
+        for (Edge* e = g->adj[u]; e; e = e->next)
+            add_one(r, e->to, u, e->w);
+    return r;
+}
+
 void graph_destroy(Graph* g) {
     for (int i = 0; i < g->n; i++) {
         Edge* cur = g->adj[i];
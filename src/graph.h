@@ -16,6 +16,15 @@ typedef struct {
 
 Graph* graph_create(int n, int directed);
 void   graph_add_edge(Graph* g, int u, int v, int w);
+// Single arc u -> v even in undirected graphs (for copying stored arcs).
+void   graph_add_arc(Graph* g, int u, int v, int w);
+// Edge u-v with weight w if there is none yet, else lowers an existing u-v
+// weight to w (never raises it); both directions when undirected. Returns 1
+// if the graph changed.
+int    graph_decrease_or_add_edge(Graph* g, int u, int v, int w);
 void   graph_destroy(Graph* g);
 
+// Graph with every arc reversed (for undirected graphs an equivalent copy).
+Graph* graph_reverse(const Graph* g);
+
 #endif
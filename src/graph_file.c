@@ -0,0 +1,63 @@
+// graph_file.c
+#include "graph_file.h"
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+int graph_file_write(const CSRGraph* g, const char* path) {
+    FILE* f = fopen(path, "wb");
+    if (!f) return -1;
+
+    GraphFileHeader hdr;
+    memcpy(hdr.magic, GRAPH_FILE_MAGIC, 4);
+    hdr.version = GRAPH_FILE_VERSION;
+    hdr.directed = (uint32_t)g->directed;
+    hdr.n = (uint32_t)g->n;
+    hdr.m = (uint64_t)g->m;
+
+    size_t n1 = (size_t)g->n + 1, m = (size_t)g->m;
+    int ok = fwrite(&hdr, sizeof(hdr), 1, f) == 1
+          && fwrite(g->offsets, sizeof(int), n1, f) == n1
+          && fwrite(g->targets, sizeof(int), m, f) == m
+          && fwrite(g->weights, sizeof(int), m, f) == m;
+    if (fclose(f) != 0) ok = 0;
+    return ok ? 0 : -1;
+}
+
+MappedGraph* graph_file_map(const char* path) {
+    MappedGraph* mg = (MappedGraph*)malloc(sizeof(MappedGraph));
+    if (mmap_file_open(&mg->file, path) != 0) {
+        free(mg);
+        return NULL;
+    }
+
+    const GraphFileHeader* hdr = (const GraphFileHeader*)mg->file.data;
+    size_t len = mg->file.len;
+    int ok = len >= sizeof(GraphFileHeader)
+          && memcmp(hdr->magic, GRAPH_FILE_MAGIC, 4) == 0
+          && hdr->version == GRAPH_FILE_VERSION
+          && hdr->n < (uint32_t)INT_MAX
+          && hdr->m <= (uint64_t)INT_MAX
+          && len == sizeof(GraphFileHeader) + sizeof(int) * ((size_t)hdr->n + 1 + 2 * (size_t)hdr->m);
+    if (!ok) {
+        mmap_file_close(&mg->file);
+        free(mg);
+        return NULL;
+    }
+
+    // CSRGraph has mutable pointers, but every CSR consumer takes it as const
+    int* base = (int*)(hdr + 1);
+    mg->csr.n = (int)hdr->n;
+    mg->csr.m = (int)hdr->m;
+    mg->csr.directed = (int)hdr->directed;
+    mg->csr.offsets = base;
+    mg->csr.targets = base + mg->csr.n + 1;
+    mg->csr.weights = mg->csr.targets + mg->csr.m;
+    return mg;
+}
+
+void graph_file_unmap(MappedGraph* mg) {
+    mmap_file_close(&mg->file);
+    free(mg);
+}
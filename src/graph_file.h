@@ -0,0 +1,42 @@
+// graph_file.h
+#ifndef GRAPH_FILE_H
+#define GRAPH_FILE_H
+
+#include <stdint.h>
+#include "csr_graph.h"
+#include "mmap_file.h"
+
+// Binary CSR graph file, native (little-endian) byte order:
+//   GraphFileHeader
+//   int32 offsets[n + 1]
+//   int32 targets[m]
+//   int32 weights[m]
+// Every section is 4-byte aligned, so a mapped file is used as-is.
+#define GRAPH_FILE_MAGIC   "CSRG"
+#define GRAPH_FILE_VERSION 1
+
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t directed;
+    uint32_t n;
+    uint64_t m;       // stored arcs (undirected edges appear twice)
+} GraphFileHeader;
+
+// A graph whose CSR arrays point straight into a read-only file mapping.
+// Pass &mg->csr to dijkstra_run_csr / prim_run_csr; nothing is copied.
+typedef struct {
+    CSRGraph csr;
+    MappedFile file;
+} MappedGraph;
+
+// Returns 0 on success, -1 on I/O error.
+int graph_file_write(const CSRGraph* g, const char* path);
+
+// Maps a file written by graph_file_write. Only the header and section
+// sizes are checked (the arrays are not scanned, keeping startup O(1)).
+// Returns NULL if the file is missing, truncated or not a v1 graph file.
+MappedGraph* graph_file_map(const char* path);
+void         graph_file_unmap(MappedGraph* mg);
+
+#endif
@@ -0,0 +1,173 @@
+// graph_gen.c
+#include "graph_gen.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+static const char* FAMILY_NAMES[GEN_FAMILY_COUNT] = {
+    "random", "grid", "rmat", "geometric", "complete"
+};
+
+// xorshift64*: small, fast and reproducible across platforms
+typedef struct {
+    uint64_t s;
+} GenRng;
+
+static uint64_t rng_next(GenRng* r) {
+    r->s ^= r->s >> 12;
+    r->s ^= r->s << 25;
+    r->s ^= r->s >> 27;
+    return r->s * 0x2545F4914F6CDD1DULL;
+}
+
+static int rng_int(GenRng* r, int lo, int hi) {
+    return lo + (int)(rng_next(r) % (uint64_t)(hi - lo + 1));
+}
+
+static double rng_unit(GenRng* r) {
+    return (double)(rng_next(r) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Edge u-v: one graph_add_edge when undirected, two arcs with their own
+// weights when directed.
+static void add_pair(Graph* g, GenRng* r, int u, int v, int w) {
+    graph_add_edge(g, u, v, w);
+    if (g->directed) graph_add_edge(g, v, u, rng_int(r, 1, 20));
+}
+
+static void gen_random(Graph* g, GenRng* r, long long m) {
+    int n = g->n;
+    if (n < 2) return;
+    for (long long i = 0; i < m; i++) {
+        int u = rng_int(r, 0, n - 1);
+        int v = rng_int(r, 0, n - 1);
+        if (u == v) { i--; continue; }
+        graph_add_edge(g, u, v, rng_int(r, 1, 20));
+    }
+}
+
+static void gen_grid(Graph* g, GenRng* r) {
+    int n = g->n;
+    int cols = (int)ceil(sqrt((double)n));
+    for (int v = 0; v < n; v++) {
+        if ((v + 1) % cols != 0 && v + 1 < n) add_pair(g, r, v, v + 1, rng_int(r, 1, 20));
+        if (v + cols < n) add_pair(g, r, v, v + cols, rng_int(r, 1, 20));
+    }
+}
+
+static void gen_rmat(Graph* g, GenRng* r, long long m) {
+    int n = g->n;
+    if (n < 2) return;
+    int scale = 0;
+    while ((1LL << scale) < n) scale++;
+    for (long long i = 0; i < m; i++) {
+        int u = 0, v = 0;
+        for (int b = 0; b < scale; b++) {
+            double p = rng_unit(r);
+            // quadrants: a = .57 (0,0), b = .19 (0,1), c = .19 (1,0), d = .05 (1,1)
+            int ub = p >= 0.76, vb = (p >= 0.57 && p < 0.76) || p >= 0.95;
+            u = (u << 1) | ub;
+            v = (v << 1) | vb;
+        }
+        if (u >= n || v >= n || u == v) { i--; continue; } // outside [0, n): redraw
+        graph_add_edge(g, u, v, rng_int(r, 1, 20));
+    }
+}
+
+static void gen_geometric(Graph* g, GenRng* r, long long m) {
+    int n = g->n;
+    if (n < 2) return;
+    double* x = (double*)malloc(sizeof(double) * (size_t)n);
+    double* y = (double*)malloc(sizeof(double) * (size_t)n);
+    for (int i = 0; i < n; i++) { x[i] = rng_unit(r); y[i] = rng_unit(r); }
+
+    // E[edges] = n^2/2 * pi * rad^2 (ignoring the border)
+    double rad = sqrt(2.0 * (double)m / (M_PI * (double)n * (double)n));
+    if (rad > 1.5) rad = 1.5;
+    int cells = (int)(1.0 / rad);
+    if (cells < 1) cells = 1;
+    if (cells > 4096) cells = 4096;
+
+    // Bucket points by cell (counting sort), then compare with the 3x3 block
+    int* start = (int*)calloc((size_t)cells * cells + 1, sizeof(int));
+    int* cell_of = (int*)malloc(sizeof(int) * (size_t)n);
+    for (int i = 0; i < n; i++) {
+        int cx = (int)(x[i] * cells), cy = (int)(y[i] * cells);
+        if (cx >= cells) cx = cells - 1;
+        if (cy >= cells) cy = cells - 1;
+        cell_of[i] = cy * cells + cx;
+        start[cell_of[i] + 1]++;
+    }
+    for (int c = 0; c < cells * cells; c++) start[c + 1] += start[c];
+    int* fill = (int*)malloc(sizeof(int) * (size_t)cells * cells);
+    memcpy(fill, start, sizeof(int) * (size_t)cells * cells);
+    int* pts = (int*)malloc(sizeof(int) * (size_t)n);
+    for (int i = 0; i < n; i++) pts[fill[cell_of[i]]++] = i;
+
+    for (int i = 0; i < n; i++) {
+        int cx = cell_of[i] % cells, cy = cell_of[i] / cells;
+        for (int dy = -1; dy <= 1; dy++) {
+            for (int dx = -1; dx <= 1; dx++) {
+                int nx = cx + dx, ny = cy + dy;
+                if (nx < 0 || ny < 0 || nx >= cells || ny >= cells) continue;
+                int c = ny * cells + nx;
+                for (int k = start[c]; k < start[c + 1]; k++) {
+                    int j = pts[k];
+                    if (j <= i) continue;
+                    double ddx = x[i] - x[j], ddy = y[i] - y[j];
+                    double d = sqrt(ddx * ddx + ddy * ddy);
+                    if (d > rad) continue;
+                    int w = 1 + (int)(d * 1000.0);
+                    graph_add_edge(g, i, j, w);
+                    if (g->directed) graph_add_edge(g, j, i, w);
+                }
+            }
+        }
+    }
+
+    free(x);
+    free(y);
+    free(start);
+    free(cell_of);
+    free(fill);
+    free(pts);
+}
+
+static void gen_complete(Graph* g, GenRng* r) {
+    for (int u = 0; u < g->n; u++)
+        for (int v = u + 1; v < g->n; v++)
+            add_pair(g, r, u, v, rng_int(r, 1, 20));
+}
+
+Graph* graph_generate(GraphFamily family, int n, long long m, int directed, uint64_t seed) {
+    GenRng r = { seed * 0x9E3779B97F4A7C15ULL + 0x2545F4914F6CDD1DULL };
+    if (r.s == 0) r.s = 1;
+    Graph* g = graph_create(n, directed);
+    switch (family) {
+    case GEN_RANDOM:    gen_random(g, &r, m); break;
+    case GEN_GRID:      gen_grid(g, &r); break;
+    case GEN_RMAT:      gen_rmat(g, &r, m); break;
+    case GEN_GEOMETRIC: gen_geometric(g, &r, m); break;
+    case GEN_COMPLETE:  gen_complete(g, &r); break;
+    default: break;
+    }
+    return g;
+}
+
+const char* graph_family_name(GraphFamily family) {
+    return family >= 0 && family < GEN_FAMILY_COUNT ? FAMILY_NAMES[family] : "?";
+}
+
+int graph_family_parse(const char* name, GraphFamily* family) {
+    for (int f = 0; f < GEN_FAMILY_COUNT; f++) {
+        if (strcmp(name, FAMILY_NAMES[f]) == 0) {
+            *family = (GraphFamily)f;
+            return 0;
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,27 @@
+// graph_gen.h
+#ifndef GRAPH_GEN_H
+#define GRAPH_GEN_H
+
+#include <stdint.h>
+#include "graph.h"
+
+// Synthetic graph families for benchmarks. Generation is deterministic for a
+// given (family, n, m, directed, seed). Directed graphs get arcs with
+// independent weights; undirected ones store each edge both ways.
+typedef enum {
+    GEN_RANDOM,    // m uniform random edges (Erdos-Renyi style), weights [1,20]
+    GEN_GRID,      // ~sqrt(n) x sqrt(n) 4-neighbour grid, weights [1,20]; m ignored
+    GEN_RMAT,      // R-MAT (a,b,c,d = .57,.19,.19,.05): power-law degrees, weights [1,20]
+    GEN_GEOMETRIC, // random points in the unit square, edges between points closer
+                   // than a radius chosen for ~m edges; weight = 1 + distance * 1000
+    GEN_COMPLETE,  // every ordered (directed) or unordered pair, weights [1,20]; m ignored
+    GEN_FAMILY_COUNT
+} GraphFamily;
+
+Graph* graph_generate(GraphFamily family, int n, long long m, int directed, uint64_t seed);
+
+const char* graph_family_name(GraphFamily family);
+// Returns 0 and sets *family if name is a family name, -1 otherwise.
+int         graph_family_parse(const char* name, GraphFamily* family);
+
+#endif
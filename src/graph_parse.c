@@ -0,0 +1,209 @@
+// graph_parse.c
+#include "graph_parse.h"
+#include "mmap_file.h"
+#include "thread_team.h"
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define GP_MIN_CHUNK (1 << 20) // smaller inputs are not worth splitting further
+
+// Output of one line-aligned slice of the input
+typedef struct {
+    const char* begin;
+    const char* end;
+    int* src;
+    int* dst;
+    int* w;
+    int count;
+    int cap;
+    long long header_n; // from a "p" line, -1 if none
+    int max_id;
+    const char* error;  // start of the first malformed line, NULL if none
+} Chunk;
+
+static const char* skip_blank(const char* p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) p++;
+    return p;
+}
+
+static const char* skip_line(const char* p, const char* end) {
+    const char* nl = (const char*)memchr(p, '\n', (size_t)(end - p));
+    return nl ? nl + 1 : end;
+}
+
+static int is_digit(char c) {
+    return (unsigned)(c - '0') < 10u;
+}
+
+// Parses a non-negative decimal after optional blanks. NULL if there is no
+// number or it does not fit in an int.
+static const char* parse_uint(const char* p, const char* end, long long* out) {
+    p = skip_blank(p, end);
+    if (p == end || !is_digit(*p)) return NULL;
+    long long v = 0;
+    while (p < end && is_digit(*p)) {
+        v = v * 10 + (*p - '0');
+        if (v > INT_MAX) return NULL;
+        p++;
+    }
+    *out = v;
+    return p;
+}
+
+static void chunk_push(Chunk* c, int u, int v, int w) {
+    if (c->count == c->cap) {
+        c->cap = c->cap ? c->cap * 2 : 1024;
+        c->src = (int*)realloc(c->src, sizeof(int) * (size_t)c->cap);
+        c->dst = (int*)realloc(c->dst, sizeof(int) * (size_t)c->cap);
+        c->w = (int*)realloc(c->w, sizeof(int) * (size_t)c->cap);
+    }
+    c->src[c->count] = u;
+    c->dst[c->count] = v;
+    c->w[c->count] = w;
+    c->count++;
+    if (u > c->max_id) c->max_id = u;
+    if (v > c->max_id) c->max_id = v;
+}
+
+static void parse_chunk(Chunk* c) {
+    const char* p = c->begin;
+    const char* end = c->end;
+    while (p < end) {
+        const char* line = p;
+        p = skip_blank(p, end);
+        if (p == end) break;
+        char tag = *p;
+        if (tag == '\n') { p++; continue; }
+        if (tag == 'c' || tag == '#' || tag == '%') { p = skip_line(p, end); continue; }
+
+        long long u, v, w = 1, m;
+        if (tag == 'p') {
+            // "p sp <n> <m>": skip the problem word, keep n
+            p = skip_blank(p + 1, end);
+            while (p < end && *p != ' ' && *p != '\t' && *p != '\n') p++;
+            if (!(p = parse_uint(p, end, &u)) || !(p = parse_uint(p, end, &m))) { c->error = line; return; }
+            c->header_n = u;
+            p = skip_line(p, end);
+            continue;
+        }
+
+        int base = 0;
+        if (tag == 'a') { p++; base = 1; }
+        if (!(p = parse_uint(p, end, &u)) || !(p = parse_uint(p, end, &v))) { c->error = line; return; }
+        const char* q = skip_blank(p, end);
+        if (q < end && is_digit(*q) && !(p = parse_uint(q, end, &w))) { c->error = line; return; }
+        p = skip_blank(p, end);
+        if ((p < end && *p != '\n') || u < base || v < base) { c->error = line; return; }
+        if (p < end) p++;
+
+        chunk_push(c, (int)(u - base), (int)(v - base), (int)w);
+    }
+}
+
+static void parse_task(void* ctx, int tid, int nthreads) {
+    (void)nthreads;
+    parse_chunk(&((Chunk*)ctx)[tid]);
+}
+
+static int fail(const char* path, const char* base, const char* at, const char* what) {
+    if (at) {
+        int line = 1;
+        for (const char* p = base; p < at; p++) line += *p == '\n';
+        fprintf(stderr, "graph_parse: %s:%d: %s\n", path, line, what);
+    } else {
+        fprintf(stderr, "graph_parse: %s: %s\n", path, what);
+    }
+    return -1;
+}
+
+int graph_parse_file(const char* path, int num_threads, EdgeList* out) {
+    memset(out, 0, sizeof(*out));
+    MappedFile mf;
+    if (mmap_file_open(&mf, path) != 0) return fail(path, NULL, NULL, "cannot open");
+
+    const char* base = (const char*)mf.data;
+    const char* end = base + mf.len;
+    int chunks = num_threads > 1 ? num_threads : 1;
+    if ((size_t)chunks > mf.len / GP_MIN_CHUNK) chunks = mf.len / GP_MIN_CHUNK > 0 ? (int)(mf.len / GP_MIN_CHUNK) : 1;
+
+    // Split at line starts so every chunk parses independently
+    Chunk* ch = (Chunk*)calloc((size_t)chunks, sizeof(Chunk));
+    for (int i = 0; i < chunks; i++) {
+        const char* b = base + mf.len / (size_t)chunks * (size_t)i;
+        if (i > 0 && b > base && b[-1] != '\n') b = skip_line(b, end);
+        ch[i].begin = i == 0 ? base : b;
+        ch[i].header_n = -1;
+        ch[i].max_id = -1;
+    }
+    for (int i = 0; i < chunks; i++) {
+        ch[i].end = i + 1 < chunks ? ch[i + 1].begin : end;
+        if (ch[i].end < ch[i].begin) ch[i].end = ch[i].begin;
+    }
+
+    if (chunks == 1) {
+        parse_chunk(&ch[0]);
+    } else {
+        ThreadTeam* team = team_create(chunks);
+        team_run(team, parse_task, ch);
+        team_destroy(team);
+    }
+
+    int rc = 0;
+    long long total = 0, header_n = -1;
+    int max_id = -1;
+    for (int i = 0; i < chunks && rc == 0; i++) {
+        if (ch[i].error) rc = fail(path, base, ch[i].error, "malformed line");
+        if (ch[i].header_n >= 0 && header_n < 0) header_n = ch[i].header_n;
+        if (ch[i].max_id > max_id) max_id = ch[i].max_id;
+        total += ch[i].count;
+    }
+    if (rc == 0 && total > INT_MAX) rc = fail(path, NULL, NULL, "too many edges");
+    if (rc == 0 && header_n >= 0 && max_id >= header_n) rc = fail(path, NULL, NULL, "vertex id exceeds the p line");
+
+    if (rc == 0) {
+        out->n = header_n >= 0 ? (int)header_n : max_id + 1;
+        out->count = (int)total;
+        out->bytes = mf.len;
+        size_t cap = (size_t)(total > 0 ? total : 1);
+        out->src = (int*)malloc(sizeof(int) * cap);
+        out->dst = (int*)malloc(sizeof(int) * cap);
+        out->w = (int*)malloc(sizeof(int) * cap);
+        int k = 0;
+        for (int i = 0; i < chunks; i++) {
+            size_t bytes = sizeof(int) * (size_t)ch[i].count;
+            if (bytes == 0) continue;
+            memcpy(out->src + k, ch[i].src, bytes);
+            memcpy(out->dst + k, ch[i].dst, bytes);
+            memcpy(out->w + k, ch[i].w, bytes);
+            k += ch[i].count;
+        }
+    }
+
+    for (int i = 0; i < chunks; i++) {
+        free(ch[i].src);
+        free(ch[i].dst);
+        free(ch[i].w);
+    }
+    free(ch);
+    mmap_file_close(&mf);
+    return rc;
+}
+
+void edge_list_free(EdgeList* el) {
+    free(el->src);
+    free(el->dst);
+    free(el->w);
+    memset(el, 0, sizeof(*el));
+}
+
+Graph* graph_from_edge_list(const EdgeList* el, int directed) {
+    Graph* g = graph_create(el->n, directed);
+    for (int i = 0; i < el->count; i++) graph_add_edge(g, el->src[i], el->dst[i], el->w[i]);
+    return g;
+}
+
+CSRGraph* csr_from_edge_list(const EdgeList* el, int directed) {
+    return csr_from_edges(el->n, el->count, el->src, el->dst, el->w, directed);
+}
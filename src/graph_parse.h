@@ -0,0 +1,34 @@
+// graph_parse.h
+#ifndef GRAPH_PARSE_H
+#define GRAPH_PARSE_H
+
+#include <stddef.h>
+#include "graph.h"
+#include "csr_graph.h"
+
+// Text graph input. One parser accepts both formats, line by line:
+//   DIMACS .gr   "c ..." comments, "p sp <n> <m>", "a <u> <v> <w>" (1-based ids)
+//   edge list    "<u> <v> [w]" (0-based ids, weight defaults to 1);
+//                lines starting with '#' or '%' are comments
+// Without a "p" line, n is the largest id + 1.
+typedef struct {
+    int n;
+    int count;   // edges parsed
+    int* src;
+    int* dst;
+    int* w;
+    size_t bytes; // input size
+} EdgeList;
+
+// Maps the file and parses it, splitting the text into line-aligned chunks
+// parsed on `num_threads` threads (<= 1: the calling thread only). Edge
+// order matches the file. Returns 0 on success; on a malformed line or I/O
+// error prints a message to stderr and returns -1.
+int  graph_parse_file(const char* path, int num_threads, EdgeList* out);
+void edge_list_free(EdgeList* el);
+
+// Builders on top of the parser.
+Graph*    graph_from_edge_list(const EdgeList* el, int directed);
+CSRGraph* csr_from_edge_list(const EdgeList* el, int directed);
+
+#endif
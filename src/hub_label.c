@@ -0,0 +1,189 @@
+// hub_label.c
+#include "hub_label.h"
+#include "search_ctx.h"
+#include "dijkstra.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define INF DIJKSTRA_INF
+
+// Label under construction; hubs arrive in rank order, so it stays sorted
+typedef struct {
+    int* hub;
+    long long* dist;
+    int size;
+    int cap;
+} LabelVec;
+
+static void label_push(LabelVec* l, int hub, long long d) {
+    if (l->size == l->cap) {
+        l->cap = l->cap ? l->cap * 2 : 4;
+        l->hub = (int*)realloc(l->hub, sizeof(int) * (size_t)l->cap);
+        l->dist = (long long*)realloc(l->dist, sizeof(long long) * (size_t)l->cap);
+    }
+    l->hub[l->size] = hub;
+    l->dist[l->size] = d;
+    l->size++;
+}
+
+// Dijkstra from hub h (rank r) that adds (r, d) to labels[v] for every v it
+// settles, unless the labels built so far already give a path of length <= d;
+// such vertices are neither labeled nor expanded. `root` is the label of h on
+// the other side (scattered into the rank-indexed `scratch` for O(1) lookups).
+static void pruned_search(SearchContext* ctx, const Graph* g, int h, int r,
+                          const LabelVec* root, LabelVec* labels, long long* scratch) {
+    int root_size = root->size;
+    for (int i = 0; i < root_size; i++) scratch[root->hub[i]] = root->dist[i];
+
+    search_ctx_begin(ctx);
+    search_ctx_relax(ctx, h, 0, 0, -1);
+
+    int v;
+    long long d;
+    while (search_ctx_pop(ctx, &v, &d)) {
+        LabelVec* l = &labels[v];
+        int covered = 0;
+        for (int i = 0; i < l->size && !covered; i++)
+            covered = scratch[l->hub[i]] + l->dist[i] <= d;
+        if (covered) continue;
+
+        label_push(l, r, d);
+        for (Edge* e = g->adj[v]; e; e = e->next)
+            search_ctx_relax(ctx, e->to, d + e->w, d + e->w, v);
+    }
+
+    // root may have grown by (r, 0) when it is labels[h] itself
+    for (int i = 0; i < root_size; i++) scratch[root->hub[i]] = INF;
+}
+
+// Flattens labels into off/hub/dist arrays with a sentinel after each label.
+static void flatten(int n, LabelVec* labels, int** off, int** hub, long long** dist) {
+    *off = (int*)malloc(sizeof(int) * (size_t)(n + 1));
+    (*off)[0] = 0;
+    for (int v = 0; v < n; v++) (*off)[v + 1] = (*off)[v] + labels[v].size + 1;
+    *hub = (int*)malloc(sizeof(int) * (size_t)(*off)[n]);
+    *dist = (long long*)malloc(sizeof(long long) * (size_t)(*off)[n]);
+    for (int v = 0; v < n; v++) {
+        int k = (*off)[v];
+        for (int i = 0; i < labels[v].size; i++, k++) {
+            (*hub)[k] = labels[v].hub[i];
+            (*dist)[k] = labels[v].dist[i];
+        }
+        (*hub)[k] = HUB_LABEL_SENTINEL;
+        (*dist)[k] = INF;
+    }
+}
+
+HubLabels* hub_labels_build(const Graph* g, const Graph* rev, const PQOps* ops) {
+    int n = g->n;
+    int directed = g->directed;
+    if (directed && !rev) {
+        fprintf(stderr, "hub_labels_build: directed graph needs its reverse graph for in-labels\n");
+        exit(1);
+    }
+
+    HubLabels* hl = (HubLabels*)malloc(sizeof(HubLabels));
+    hl->n = n;
+    hl->directed = directed;
+
+    // Hub order: total degree, highest first (counting sort, stable by id)
+    int* deg = (int*)calloc((size_t)n, sizeof(int));
+    int max_deg = 0;
+    for (int u = 0; u < n; u++) {
+        for (Edge* e = g->adj[u]; e; e = e->next) {
+            deg[u]++;
+            if (directed) deg[e->to]++;
+        }
+    }
+    for (int v = 0; v < n; v++) if (deg[v] > max_deg) max_deg = deg[v];
+    int* bucket = (int*)calloc((size_t)max_deg + 2, sizeof(int));
+    for (int v = 0; v < n; v++) bucket[max_deg - deg[v] + 1]++;
+    for (int d = 1; d <= max_deg + 1; d++) bucket[d] += bucket[d - 1];
+    hl->order = (int*)malloc(sizeof(int) * (size_t)n);
+    for (int v = 0; v < n; v++) hl->order[bucket[max_deg - deg[v]]++] = v;
+    free(bucket);
+    free(deg);
+
+    LabelVec* out = (LabelVec*)calloc((size_t)n, sizeof(LabelVec));
+    LabelVec* in = directed ? (LabelVec*)calloc((size_t)n, sizeof(LabelVec)) : out;
+    long long* scratch = (long long*)malloc(sizeof(long long) * (size_t)n);
+    for (int i = 0; i < n; i++) scratch[i] = INF;
+    SearchContext* ctx = search_ctx_create(n, ops);
+
+    for (int r = 0; r < n; r++) {
+        int h = hl->order[r];
+        pruned_search(ctx, g, h, r, &out[h], in, scratch);       // d(h, v) into in(v)
+        if (directed) pruned_search(ctx, rev, h, r, &in[h], out, scratch); // d(v, h) into out(v)
+    }
+
+    search_ctx_destroy(ctx);
+    free(scratch);
+
+    flatten(n, out, &hl->out_off, &hl->out_hub, &hl->out_dist);
+    if (directed) {
+        flatten(n, in, &hl->in_off, &hl->in_hub, &hl->in_dist);
+    } else {
+        hl->in_off = hl->out_off;
+        hl->in_hub = hl->out_hub;
+        hl->in_dist = hl->out_dist;
+    }
+
+    for (int v = 0; v < n; v++) {
+        free(out[v].hub);
+        free(out[v].dist);
+        if (directed) {
+            free(in[v].hub);
+            free(in[v].dist);
+        }
+    }
+    free(out);
+    if (directed) free(in);
+    return hl;
+}
+
+void hub_labels_destroy(HubLabels* hl) {
+    if (hl->directed) {
+        free(hl->in_off);
+        free(hl->in_hub);
+        free(hl->in_dist);
+    }
+    free(hl->out_off);
+    free(hl->out_hub);
+    free(hl->out_dist);
+    free(hl->order);
+    free(hl);
+}
+
+long long hub_labels_query(const HubLabels* hl, int s, int t) {
+    const int* ha = hl->out_hub + hl->out_off[s];
+    const long long* da = hl->out_dist + hl->out_off[s];
+    const int* hb = hl->in_hub + hl->in_off[t];
+    const long long* db = hl->in_dist + hl->in_off[t];
+
+    // Merge-intersection without data-dependent branches: both cursors advance
+    // by comparison results and the minimum is a conditional move. Sentinels
+    // (max rank, INF distance) end the loop once both labels are exhausted.
+    long long best = INF;
+    int i = 0, j = 0;
+    for (;;) {
+        int x = ha[i], y = hb[j];
+        long long d = da[i] + db[j];
+        best = (x == y && d < best) ? d : best;
+        if ((x & y) == HUB_LABEL_SENTINEL) break;
+        i += x <= y;
+        j += y <= x;
+    }
+    return best;
+}
+
+long long hub_labels_entries(const HubLabels* hl) {
+    long long e = (long long)hl->out_off[hl->n] - hl->n;
+    if (hl->directed) e += (long long)hl->in_off[hl->n] - hl->n;
+    return e;
+}
+
+size_t hub_labels_bytes(const HubLabels* hl) {
+    size_t sets = hl->directed ? 2 : 1;
+    size_t cells = (size_t)hl->out_off[hl->n] + (hl->directed ? (size_t)hl->in_off[hl->n] : 0);
+    return cells * (sizeof(int) + sizeof(long long)) + sets * sizeof(int) * (size_t)(hl->n + 1);
+}
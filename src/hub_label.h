@@ -0,0 +1,43 @@
+// hub_label.h
+#ifndef HUB_LABEL_H
+#define HUB_LABEL_H
+
+#include "graph.h"
+#include "pq.h"
+
+// Hub labels from pruned landmark labeling (2-hop cover): d(s, t) is the
+// minimum of out(s)[h] + in(t)[h] over hubs h common to both labels.
+//
+// Each label is a flat run of hub ranks (ascending) with a parallel array of
+// distances, terminated by a HUB_LABEL_SENTINEL entry, so the query is a
+// branch-free merge over two int arrays with no bounds checks.
+#define HUB_LABEL_SENTINEL 0x7fffffff
+
+typedef struct {
+    int n;
+    int directed;      // undirected graphs share one label set (in == out)
+    int* order;        // order[r]: vertex of hub rank r (highest degree first)
+    // out label of v: d(v, hub), entries [out_off[v], out_off[v+1]) incl. sentinel
+    int* out_off;
+    int* out_hub;
+    long long* out_dist;
+    // in label of v: d(hub, v)
+    int* in_off;
+    int* in_hub;
+    long long* in_dist;
+} HubLabels;
+
+// Runs one pruned Dijkstra per vertex (two for directed graphs: on g and on
+// rev) through `ops`. rev may be NULL only when g is undirected; a directed g
+// without rev prints an error and exits.
+HubLabels* hub_labels_build(const Graph* g, const Graph* rev, const PQOps* ops);
+void       hub_labels_destroy(HubLabels* hl);
+
+// Distance from s to t, or DIJKSTRA_INF if t is unreachable.
+long long hub_labels_query(const HubLabels* hl, int s, int t);
+
+// Label entries (without sentinels) and bytes held by the label arrays.
+long long hub_labels_entries(const HubLabels* hl);
+size_t    hub_labels_bytes(const HubLabels* hl);
+
+#endif
@@ -0,0 +1,27 @@
+// latency_hist.c
+#include "latency_hist.h"
+
+void latency_hist_merge(LatencyHist* dst, const LatencyHist* src) {
+    for (int i = 0; i < LAT_HIST_BUCKETS; i++) dst->bucket[i] += src->bucket[i];
+    dst->count += src->count;
+    if (src->max > dst->max) dst->max = src->max;
+}
+
+double latency_hist_quantile(const LatencyHist* h, double q) {
+    if (h->count == 0) return 0.0;
+    uint64_t rank = (uint64_t)(q * (double)h->count);
+    if (rank >= h->count) rank = h->count - 1;
+
+    uint64_t seen = 0;
+    for (int i = 0; i < LAT_HIST_BUCKETS; i++) {
+        seen += h->bucket[i];
+        if (seen <= rank) continue;
+        if (i < (1 << LAT_HIST_SUB_BITS)) return (double)i;
+        int e = (i >> LAT_HIST_SUB_BITS) + LAT_HIST_SUB_BITS - 1;
+        int sub = i & ((1 << LAT_HIST_SUB_BITS) - 1);
+        uint64_t width = 1ull << (e - LAT_HIST_SUB_BITS);
+        double mid = (double)(((uint64_t)(1 << LAT_HIST_SUB_BITS) + sub) * width) + (double)width / 2.0;
+        return mid < (double)h->max ? mid : (double)h->max;
+    }
+    return (double)h->max;
+}
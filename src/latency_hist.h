@@ -0,0 +1,38 @@
+// latency_hist.h
+#ifndef LATENCY_HIST_H
+#define LATENCY_HIST_H
+
+#include <stdint.h>
+
+// Log-linear latency histogram: values below 8 get their own bucket, larger
+// ones are split into 8 sub-buckets per power of two (<= 12.5% relative
+// error), covering the full uint64_t range in fixed memory.
+#define LAT_HIST_SUB_BITS 3
+#define LAT_HIST_BUCKETS  ((64 - LAT_HIST_SUB_BITS + 1) << LAT_HIST_SUB_BITS)
+
+typedef struct {
+    uint64_t count;
+    uint64_t max;
+    uint64_t bucket[LAT_HIST_BUCKETS];
+} LatencyHist;
+
+static inline int latency_hist_index(uint64_t v) {
+    if (v < (1u << LAT_HIST_SUB_BITS)) return (int)v;
+    int e = 63 - __builtin_clzll(v);
+    int sub = (int)(v >> (e - LAT_HIST_SUB_BITS)) & ((1 << LAT_HIST_SUB_BITS) - 1);
+    return ((e - LAT_HIST_SUB_BITS + 1) << LAT_HIST_SUB_BITS) + sub;
+}
+
+static inline void latency_hist_add(LatencyHist* h, uint64_t v) {
+    h->bucket[latency_hist_index(v)]++;
+    h->count++;
+    if (v > h->max) h->max = v;
+}
+
+void latency_hist_merge(LatencyHist* dst, const LatencyHist* src);
+
+// Value at quantile q in [0, 1] (bucket midpoint, capped at the maximum);
+// 0 for an empty histogram.
+double latency_hist_quantile(const LatencyHist* h, double q);
+
+#endif
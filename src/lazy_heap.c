@@ -0,0 +1,20 @@
+// lazy_heap.c
+#include "lazy_heap.h"
+#include <stdlib.h>
+
+void lazy_heap_init(LazyHeap* h, int capacity) {
+    h->size = 0;
+    h->cap = capacity > 0 ? capacity : 16;
+    h->a = (PQItem*)malloc(sizeof(PQItem) * (size_t)h->cap);
+}
+
+void lazy_heap_free(LazyHeap* h) {
+    free(h->a);
+    h->a = NULL;
+    h->size = h->cap = 0;
+}
+
+void lazy_heap_grow(LazyHeap* h) {
+    h->cap *= 2;
+    h->a = (PQItem*)realloc(h->a, sizeof(PQItem) * (size_t)h->cap);
+}
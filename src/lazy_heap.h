@@ -0,0 +1,54 @@
+// lazy_heap.h
+#ifndef LAZY_HEAP_H
+#define LAZY_HEAP_H
+
+#include "pq.h"
+
+// Insert-only 4-ary min-heap of (key, value) pairs for lazy Dijkstra/Prim:
+// no handles and no decrease-key, so a value may be queued several times and
+// the caller discards stale pops. Items are moved, not pointed to, and four
+// children share a cache line.
+typedef struct {
+    PQItem* a;
+    int size;
+    int cap;
+} LazyHeap;
+
+void lazy_heap_init(LazyHeap* h, int capacity);
+void lazy_heap_free(LazyHeap* h);
+void lazy_heap_grow(LazyHeap* h);
+
+static inline void lazy_heap_push(LazyHeap* h, long long key, int value) {
+    if (h->size == h->cap) lazy_heap_grow(h);
+    int i = h->size++;
+    while (i > 0) {
+        int p = (i - 1) >> 2;
+        if (h->a[p].key <= key) break;
+        h->a[i] = h->a[p];
+        i = p;
+    }
+    h->a[i].key = key;
+    h->a[i].value = value;
+}
+
+// Heap must be non-empty
+static inline PQItem lazy_heap_pop(LazyHeap* h) {
+    PQItem top = h->a[0];
+    PQItem last = h->a[--h->size];
+    int n = h->size, i = 0;
+    for (;;) {
+        int c = 4 * i + 1;
+        if (c >= n) break;
+        int best = c;
+        int end = c + 4 < n ? c + 4 : n;
+        for (int k = c + 1; k < end; k++)
+            if (h->a[k].key < h->a[best].key) best = k;
+        if (last.key <= h->a[best].key) break;
+        h->a[i] = h->a[best];
+        i = best;
+    }
+    if (n > 0) h->a[i] = last;
+    return top;
+}
+
+#endif
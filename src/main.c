@@ -9,6 +9,10 @@
 
 #include "fibheap_pq.h"
 #include "pairing_pq.h"
+#include "dary_pq.h"
+#include "radix_pq.h"
+#include "dial_pq.h"
+#include "graph_parse.h"
 
 static void run_and_print_dijkstra(const char *label,
                                    const Graph *g,
@@ -30,7 +34,7 @@ static void run_and_print_prim(const char *label,
                                const Graph *g,
                                int root,
                                const PQOps *ops) {
-    PrimResult p = prim_run(g, root, ops);
+    PrimResult p = prim_run_heap(g, root, ops);
 
     printf("\n%s\n", label);
     printf("Prim MST total weight (root=%d): %" PRId64 "\n",
@@ -44,7 +48,40 @@ static void run_and_print_prim(const char *label,
     prim_free(p);
 }
 
-int main(void) {
+// Dijkstra from vertex 0 of a DIMACS .gr / edge-list file, summarized per heap.
+static int run_file(const char *path) {
+    EdgeList el;
+    if (graph_parse_file(path, 1, &el) != 0) return 1;
+    Graph *g = graph_from_edge_list(&el, 1);
+    printf("Loaded %s: n=%d edges=%d\n", path, el.n, el.count);
+    edge_list_free(&el);
+    if (g->n == 0) { graph_destroy(g); return 0; }
+
+    const char *names[] = { "Binary Heap", "Fibonacci Heap", "Pairing Heap",
+                            "4-ary Indexed Heap", "Radix Heap", "Dial Buckets" };
+    const PQOps *ops[] = { &BINHEAP_OPS, &fibheap_pq_ops, &pairing_pq_ops,
+                           &DARY4_OPS, &RADIX_OPS, &DIAL_OPS };
+    for (int h = 0; h < 6; h++) {
+        DijkstraResult d = dijkstra_run(g, 0, ops[h]);
+        int reached = 0;
+        long long far = 0;
+        for (int i = 0; i < g->n; i++) {
+            if (d.dist[i] >= DIJKSTRA_INF) continue;
+            reached++;
+            if (d.dist[i] > far) far = d.dist[i];
+        }
+        printf("Dijkstra from 0 using %s: reached %d, farthest %" PRId64 "\n",
+               names[h], reached, (int64_t)far);
+        dijkstra_free(d);
+    }
+
+    graph_destroy(g);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc > 1) return run_file(argv[1]);
+
     Graph *g = graph_create(5, 0);
 
     graph_add_edge(g, 0, 1, 4);
@@ -58,11 +95,15 @@ int main(void) {
     run_and_print_dijkstra("=== Dijkstra using Binary Heap ===", g, 0, &BINHEAP_OPS);
     run_and_print_dijkstra("=== Dijkstra using Fibonacci Heap ===", g, 0, &fibheap_pq_ops);
     run_and_print_dijkstra("=== Dijkstra using Pairing Heap ===", g, 0, &pairing_pq_ops);
+    run_and_print_dijkstra("=== Dijkstra using 4-ary Indexed Heap ===", g, 0, &DARY4_OPS);
+    run_and_print_dijkstra("=== Dijkstra using Radix Heap ===", g, 0, &RADIX_OPS);
+    run_and_print_dijkstra("=== Dijkstra using Dial Buckets ===", g, 0, &DIAL_OPS);
 
     // Prim tests
     run_and_print_prim("=== Prim using Binary Heap ===", g, 0, &BINHEAP_OPS);
     run_and_print_prim("=== Prim using Fibonacci Heap ===", g, 0, &fibheap_pq_ops);
     run_and_print_prim("=== Prim using Pairing Heap ===", g, 0, &pairing_pq_ops);
+    run_and_print_prim("=== Prim using 4-ary Indexed Heap ===", g, 0, &DARY4_OPS);
 
     graph_destroy(g);
     return 0;
@@ -0,0 +1,125 @@
+// min_scan.c
+#include "min_scan.h"
+
+// Kernels: AVX2 when the build targets it; otherwise, with GCC/Clang on x86,
+// an AVX2 kernel compiled on its own and picked at run time if the CPU has
+// it, falling back to SSE2 (always present on x86-64) or a scalar loop.
+#if defined(__AVX2__)
+#define MIN_SCAN_AVX2 1
+#define MIN_SCAN_DISPATCH 0
+#elif (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define MIN_SCAN_AVX2 1
+#define MIN_SCAN_DISPATCH 1
+#else
+#define MIN_SCAN_AVX2 0
+#define MIN_SCAN_DISPATCH 0
+#endif
+#if defined(__SSE2__) && !(MIN_SCAN_AVX2 && !MIN_SCAN_DISPATCH)
+#define MIN_SCAN_SSE2 1
+#else
+#define MIN_SCAN_SSE2 0
+#endif
+
+#if MIN_SCAN_AVX2 || MIN_SCAN_SSE2
+#include <immintrin.h>
+#endif
+
+// Scalar first-minimum over a[i..n), continuing from (bv, best)
+static int scan_tail(const int* a, int i, int n, int bv, int best) {
+    for (; i < n; i++)
+        if (a[i] < bv) { bv = a[i]; best = i; }
+    return best;
+}
+
+#if MIN_SCAN_AVX2 || MIN_SCAN_SSE2
+// Lane results -> (value, index) with value ties broken by the smaller index
+static int reduce_lanes(const int* mv, const int* mi, int lanes, int* bv) {
+    int best = mi[0];
+    *bv = mv[0];
+    for (int k = 1; k < lanes; k++)
+        if (mv[k] < *bv || (mv[k] == *bv && mi[k] < best)) { *bv = mv[k]; best = mi[k]; }
+    return best;
+}
+#endif
+
+// Each lane keeps its own running (min, index); a lane only takes a new index
+// on a strictly smaller value, so lane indices are the first occurrences.
+#if MIN_SCAN_AVX2
+#if MIN_SCAN_DISPATCH
+__attribute__((target("avx2")))
+#endif
+static int min_scan_avx2(const int* a, int n) {
+    if (n < 8) return scan_tail(a, 1, n, a[0], 0);
+    __m256i vmin = _mm256_loadu_si256((const __m256i*)a);
+    __m256i vidx = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i cur = vidx;
+    const __m256i step = _mm256_set1_epi32(8);
+    int i;
+    for (i = 8; i + 8 <= n; i += 8) {
+        cur = _mm256_add_epi32(cur, step);
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i lt = _mm256_cmpgt_epi32(vmin, x);
+        vmin = _mm256_min_epi32(vmin, x);
+        vidx = _mm256_blendv_epi8(vidx, cur, lt);
+    }
+    int mv[8], mi[8], bv;
+    _mm256_storeu_si256((__m256i*)mv, vmin);
+    _mm256_storeu_si256((__m256i*)mi, vidx);
+    int best = reduce_lanes(mv, mi, 8, &bv);
+    return scan_tail(a, i, n, bv, best);
+}
+#endif
+
+#if MIN_SCAN_SSE2
+static int min_scan_sse2(const int* a, int n) {
+    if (n < 4) return scan_tail(a, 1, n, a[0], 0);
+    __m128i vmin = _mm_loadu_si128((const __m128i*)a);
+    __m128i vidx = _mm_setr_epi32(0, 1, 2, 3);
+    __m128i cur = vidx;
+    const __m128i step = _mm_set1_epi32(4);
+    int i;
+    for (i = 4; i + 4 <= n; i += 4) {
+        cur = _mm_add_epi32(cur, step);
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i lt = _mm_cmplt_epi32(x, vmin);
+        // SSE2 has no 32-bit min or blend: select through the mask
+        vmin = _mm_or_si128(_mm_and_si128(lt, x), _mm_andnot_si128(lt, vmin));
+        vidx = _mm_or_si128(_mm_and_si128(lt, cur), _mm_andnot_si128(lt, vidx));
+    }
+    int mv[4], mi[4], bv;
+    _mm_storeu_si128((__m128i*)mv, vmin);
+    _mm_storeu_si128((__m128i*)mi, vidx);
+    int best = reduce_lanes(mv, mi, 4, &bv);
+    return scan_tail(a, i, n, bv, best);
+}
+#define MIN_SCAN_BASE min_scan_sse2
+#define MIN_SCAN_BASE_ISA "sse2"
+#elif !MIN_SCAN_AVX2 || MIN_SCAN_DISPATCH
+static int min_scan_scalar(const int* a, int n) {
+    return scan_tail(a, 1, n, a[0], 0);
+}
+#define MIN_SCAN_BASE min_scan_scalar
+#define MIN_SCAN_BASE_ISA "scalar"
+#endif
+
+int min_scan_i32(const int* a, int n) {
+#if MIN_SCAN_AVX2 && !MIN_SCAN_DISPATCH
+    return min_scan_avx2(a, n);
+#else
+#if MIN_SCAN_DISPATCH
+    if (__builtin_cpu_supports("avx2")) return min_scan_avx2(a, n);
+#endif
+    return MIN_SCAN_BASE(a, n);
+#endif
+}
+
+const char* min_scan_isa(void) {
+#if MIN_SCAN_AVX2 && !MIN_SCAN_DISPATCH
+    return "avx2";
+#else
+#if MIN_SCAN_DISPATCH
+    if (__builtin_cpu_supports("avx2")) return "avx2";
+#endif
+    return MIN_SCAN_BASE_ISA;
+#endif
+}
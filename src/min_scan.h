@@ -0,0 +1,13 @@
+// min_scan.h
+#ifndef MIN_SCAN_H
+#define MIN_SCAN_H
+
+// Index of the first smallest of a[0..n-1] (n > 0), in one vectorized pass:
+// AVX2 (8 lanes) when the CPU supports it (checked at run time, or always
+// with -mavx2), else SSE2 (4 lanes) on x86-64, else a scalar loop.
+int min_scan_i32(const int* a, int n);
+
+// Kernel in use on this CPU: "avx2", "sse2" or "scalar"
+const char* min_scan_isa(void);
+
+#endif
@@ -0,0 +1,68 @@
+// mmap_file.c
+#include "mmap_file.h"
+
+#ifdef _WIN32
+#include <windows.h>
+
+int mmap_file_open(MappedFile* mf, const char* path) {
+    mf->data = NULL;
+    mf->len = 0;
+    mf->mapping = NULL;
+    mf->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                           FILE_ATTRIBUTE_NORMAL, NULL);
+    if (mf->file == INVALID_HANDLE_VALUE) return -1;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(mf->file, &size)) { CloseHandle(mf->file); return -1; }
+    mf->len = (size_t)size.QuadPart;
+    if (mf->len == 0) return 0; // empty files cannot be mapped
+
+    mf->mapping = CreateFileMappingA(mf->file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mf->mapping) mf->data = MapViewOfFile(mf->mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!mf->data) {
+        if (mf->mapping) CloseHandle(mf->mapping);
+        CloseHandle(mf->file);
+        return -1;
+    }
+    return 0;
+}
+
+void mmap_file_close(MappedFile* mf) {
+    if (mf->data) UnmapViewOfFile(mf->data);
+    if (mf->mapping) CloseHandle(mf->mapping);
+    CloseHandle(mf->file);
+    mf->data = NULL;
+    mf->len = 0;
+}
+
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+int mmap_file_open(MappedFile* mf, const char* path) {
+    mf->data = NULL;
+    mf->len = 0;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return -1;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) { close(fd); return -1; }
+    mf->len = (size_t)st.st_size;
+    if (mf->len > 0) {
+        void* p = mmap(NULL, mf->len, PROT_READ, MAP_SHARED, fd, 0);
+        if (p == MAP_FAILED) { close(fd); mf->len = 0; return -1; }
+        mf->data = p;
+    }
+    close(fd); // the mapping stays valid
+    return 0;
+}
+
+void mmap_file_close(MappedFile* mf) {
+    if (mf->data) munmap((void*)mf->data, mf->len);
+    mf->data = NULL;
+    mf->len = 0;
+}
+
+#endif
@@ -0,0 +1,22 @@
+// mmap_file.h
+#ifndef MMAP_FILE_H
+#define MMAP_FILE_H
+
+#include <stddef.h>
+
+// Read-only, shared memory mapping of a whole file. Pages are loaded on
+// demand and shared with every other process mapping the same file.
+typedef struct {
+    const void* data; // NULL for an empty file
+    size_t len;
+#ifdef _WIN32
+    void* file;       // HANDLE
+    void* mapping;    // HANDLE
+#endif
+} MappedFile;
+
+// Returns 0 on success, -1 if the file cannot be opened or mapped.
+int  mmap_file_open(MappedFile* mf, const char* path);
+void mmap_file_close(MappedFile* mf);
+
+#endif
@@ -0,0 +1,126 @@
+// mq_sssp.c
+#include "mq_sssp.h"
+#include "multiqueue.h"
+#include "sssp_tree.h"
+#include "thread_team.h"
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define INF DIJKSTRA_INF
+
+typedef struct {
+    const CSRGraph* g;
+    MultiQueue* mq;
+    long long* dist;
+    int* parent;
+    long long pending;      // items pushed but not yet fully processed
+    uint64_t seed;
+    MQSSSPStats* per_thread;
+} MQState;
+
+static int mq_relax(long long* dist, int v, long long nd) {
+    long long old = __atomic_load_n(&dist[v], __ATOMIC_RELAXED);
+    while (nd < old) {
+        if (__atomic_compare_exchange_n(&dist[v], &old, nd, 1,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            return 1;
+    }
+    return 0;
+}
+
+static void mq_search(MQState* st, int tid) {
+    const int* off = st->g->offsets;
+    const int* to = st->g->targets;
+    const int* wt = st->g->weights;
+    uint64_t rng = st->seed * 0x9E3779B97F4A7C15ULL + (uint64_t)tid * 0xBF58476D1CE4E5B9ULL + 1;
+    if (rng == 0) rng = 1;
+    MQSSSPStats s;
+    memset(&s, 0, sizeof(s));
+
+    for (;;) {
+        PQItem it;
+        if (!multiqueue_pop(st->mq, &rng, &it)) {
+            // Nothing visible: done once no item is queued or being expanded
+            if (__atomic_load_n(&st->pending, __ATOMIC_ACQUIRE) == 0) break;
+            sched_yield();
+            continue;
+        }
+        s.pops++;
+        int u = it.value;
+        long long du = it.key;
+        if (du != __atomic_load_n(&st->dist[u], __ATOMIC_RELAXED)) {
+            s.stale_pops++;
+        } else {
+            s.expansions++;
+            for (int k = off[u]; k < off[u + 1]; k++) {
+                int v = to[k];
+                long long nd = du + wt[k];
+                if (!mq_relax(st->dist, v, nd)) continue;
+                // Count before publishing so pending never reads 0 early
+                __atomic_fetch_add(&st->pending, 1, __ATOMIC_RELAXED);
+                multiqueue_push(st->mq, &rng, nd, v);
+                s.pushes++;
+            }
+        }
+        __atomic_fetch_sub(&st->pending, 1, __ATOMIC_RELEASE);
+    }
+    st->per_thread[tid] = s;
+}
+
+static void mq_work(void* ctx, int tid, int nthreads) {
+    (void)nthreads;
+    mq_search((MQState*)ctx, tid);
+}
+
+void mq_sssp_default_config(MQSSSPConfig* cfg) {
+    cfg->num_threads = 1;
+    cfg->queues_per_thread = 2;
+    cfg->seed = 1;
+}
+
+DijkstraResult mq_sssp_run(const CSRGraph* g, int source, const MQSSSPConfig* cfg,
+                           MQSSSPStats* stats) {
+    int n = g->n;
+    int threads = cfg->num_threads > 0 ? cfg->num_threads : 1;
+    int c = cfg->queues_per_thread > 0 ? cfg->queues_per_thread : 2;
+
+    MQState st;
+    st.g = g;
+    st.mq = multiqueue_create(c * threads);
+    st.dist = (long long*)malloc(sizeof(long long) * n);
+    st.parent = (int*)malloc(sizeof(int) * n);
+    st.seed = cfg->seed;
+    st.per_thread = (MQSSSPStats*)calloc((size_t)threads, sizeof(MQSSSPStats));
+    for (int i = 0; i < n; i++) {
+        st.dist[i] = INF;
+        st.parent[i] = -1;
+    }
+
+    st.dist[source] = 0;
+    st.pending = 1;
+    uint64_t rng = cfg->seed | 1;
+    multiqueue_push(st.mq, &rng, 0, source);
+
+    ThreadTeam* team = team_create(threads);
+    team_run(team, mq_work, &st);
+    sssp_tree_parents(g, source, st.dist, st.parent, team);
+    team_destroy(team);
+
+    if (stats) {
+        memset(stats, 0, sizeof(*stats));
+        stats->pushes = 1;
+        for (int t = 0; t < threads; t++) {
+            stats->pushes += st.per_thread[t].pushes;
+            stats->pops += st.per_thread[t].pops;
+            stats->stale_pops += st.per_thread[t].stale_pops;
+            stats->expansions += st.per_thread[t].expansions;
+        }
+        for (int i = 0; i < n; i++) stats->reached += st.dist[i] < INF;
+    }
+
+    free(st.per_thread);
+    multiqueue_destroy(st.mq);
+    DijkstraResult r = { st.dist, st.parent };
+    return r;
+}
@@ -0,0 +1,35 @@
+// mq_sssp.h
+#ifndef MQ_SSSP_H
+#define MQ_SSSP_H
+
+#include <stdint.h>
+#include "csr_graph.h"
+#include "dijkstra.h"
+
+typedef struct {
+    int num_threads;        // worker threads including the caller (>= 1)
+    int queues_per_thread;  // c: the MultiQueue holds c * num_threads heaps
+    uint64_t seed;          // per-thread queue-choice RNG seed
+} MQSSSPConfig;
+
+// Work counters of one run. With a relaxed queue a vertex can be expanded
+// before its final distance is known and expanded again later; the sequential
+// algorithm does exactly `reached` expansions.
+typedef struct {
+    long long pushes;
+    long long pops;
+    long long stale_pops;   // popped key already superseded (skipped)
+    long long expansions;   // pops whose out-edges were relaxed
+    long long reached;      // vertices with a finite distance
+} MQSSSPStats;
+
+void mq_sssp_default_config(MQSSSPConfig* cfg);
+
+// Parallel label-correcting SSSP over a MultiQueue (pthreads) on a CSR graph
+// with non-negative weights. Same result as dijkstra_run_csr (parent[v] is
+// some predecessor on a shortest path); free with dijkstra_free. stats may
+// be NULL.
+DijkstraResult mq_sssp_run(const CSRGraph* g, int source, const MQSSSPConfig* cfg,
+                           MQSSSPStats* stats);
+
+#endif
@@ -0,0 +1,133 @@
+// multiqueue.c
+#include "multiqueue.h"
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MQ_EMPTY LLONG_MAX
+#define MQ_CACHE_LINE 64
+
+typedef struct {
+    int lock;       // 0 free, 1 held (try-lock only, never waited on)
+    int size;
+    int cap;
+    long long top;  // minimum key, MQ_EMPTY if empty; read without the lock
+    PQItem* heap;
+} MQHeap;
+
+// One heap per cache line, so threads working on different heaps never
+// invalidate each other's lock or top.
+typedef union {
+    MQHeap h;
+    char pad[MQ_CACHE_LINE];
+} MQSlot;
+
+struct MultiQueue {
+    int count;
+    MQSlot* slots;
+};
+
+static inline uint64_t mq_rand(uint64_t* s) {
+    uint64_t x = *s;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return *s = x;
+}
+
+static inline int mq_try_lock(MQHeap* h) {
+    return __atomic_load_n(&h->lock, __ATOMIC_RELAXED) == 0 &&
+           __atomic_exchange_n(&h->lock, 1, __ATOMIC_ACQUIRE) == 0;
+}
+
+static inline void mq_unlock(MQHeap* h) {
+    __atomic_store_n(&h->top, h->size ? h->heap[0].key : MQ_EMPTY, __ATOMIC_RELAXED);
+    __atomic_store_n(&h->lock, 0, __ATOMIC_RELEASE);
+}
+
+static void heap_push(MQHeap* h, long long key, int value) {
+    if (h->size == h->cap) {
+        h->cap = h->cap ? h->cap * 2 : 256;
+        h->heap = (PQItem*)realloc(h->heap, sizeof(PQItem) * (size_t)h->cap);
+    }
+    int i = h->size++;
+    while (i > 0) {
+        int p = (i - 1) / 2;
+        if (h->heap[p].key <= key) break;
+        h->heap[i] = h->heap[p];
+        i = p;
+    }
+    h->heap[i].key = key;
+    h->heap[i].value = value;
+}
+
+static PQItem heap_pop(MQHeap* h) {
+    PQItem top = h->heap[0];
+    PQItem last = h->heap[--h->size];
+    int n = h->size, i = 0;
+    for (;;) {
+        int c = 2 * i + 1;
+        if (c >= n) break;
+        if (c + 1 < n && h->heap[c + 1].key < h->heap[c].key) c++;
+        if (last.key <= h->heap[c].key) break;
+        h->heap[i] = h->heap[c];
+        i = c;
+    }
+    if (n > 0) h->heap[i] = last;
+    return top;
+}
+
+MultiQueue* multiqueue_create(int num_queues) {
+    MultiQueue* mq = (MultiQueue*)malloc(sizeof(MultiQueue));
+    mq->count = num_queues > 0 ? num_queues : 1;
+    mq->slots = (MQSlot*)aligned_alloc(MQ_CACHE_LINE, sizeof(MQSlot) * (size_t)mq->count);
+    memset(mq->slots, 0, sizeof(MQSlot) * (size_t)mq->count);
+    for (int i = 0; i < mq->count; i++) mq->slots[i].h.top = MQ_EMPTY;
+    return mq;
+}
+
+void multiqueue_destroy(MultiQueue* mq) {
+    for (int i = 0; i < mq->count; i++) free(mq->slots[i].h.heap);
+    free(mq->slots);
+    free(mq);
+}
+
+void multiqueue_push(MultiQueue* mq, uint64_t* rng, long long key, int value) {
+    for (;;) {
+        MQHeap* h = &mq->slots[mq_rand(rng) % (uint64_t)mq->count].h;
+        if (!mq_try_lock(h)) continue;
+        heap_push(h, key, value);
+        mq_unlock(h);
+        return;
+    }
+}
+
+int multiqueue_pop(MultiQueue* mq, uint64_t* rng, PQItem* out) {
+    // Two random choices; a lost try-lock or a race that emptied the heap just
+    // draws again. After a few all-empty draws fall back to a full scan.
+    for (int attempt = 0; attempt < 4; ) {
+        MQHeap* a = &mq->slots[mq_rand(rng) % (uint64_t)mq->count].h;
+        MQHeap* b = &mq->slots[mq_rand(rng) % (uint64_t)mq->count].h;
+        long long ka = __atomic_load_n(&a->top, __ATOMIC_RELAXED);
+        long long kb = __atomic_load_n(&b->top, __ATOMIC_RELAXED);
+        MQHeap* h = kb < ka ? b : a;
+        if ((kb < ka ? kb : ka) == MQ_EMPTY) { attempt++; continue; }
+        if (!mq_try_lock(h)) continue;
+        if (h->size == 0) { mq_unlock(h); continue; }
+        *out = heap_pop(h);
+        mq_unlock(h);
+        return 1;
+    }
+
+    int start = (int)(mq_rand(rng) % (uint64_t)mq->count);
+    for (int k = 0; k < mq->count; k++) {
+        MQHeap* h = &mq->slots[(start + k) % mq->count].h;
+        if (__atomic_load_n(&h->top, __ATOMIC_RELAXED) == MQ_EMPTY) continue;
+        while (!mq_try_lock(h)) { }
+        if (h->size == 0) { mq_unlock(h); continue; }
+        *out = heap_pop(h);
+        mq_unlock(h);
+        return 1;
+    }
+    return 0;
+}
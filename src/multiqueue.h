@@ -0,0 +1,25 @@
+// multiqueue.h
+#ifndef MULTIQUEUE_H
+#define MULTIQUEUE_H
+
+#include <stdint.h>
+#include "pq.h"
+
+// Relaxed concurrent priority queue (MultiQueue): num_queues binary heaps,
+// each behind a try-lock. push goes to a random heap; pop compares the minima
+// of two random heaps and takes the smaller one (power of two choices), so it
+// returns an element close to, but not always, the global minimum. Callers
+// pass their own xorshift state (non-zero), one per thread.
+typedef struct MultiQueue MultiQueue;
+
+// num_queues is typically c * threads with c = 2..4
+MultiQueue* multiqueue_create(int num_queues);
+void        multiqueue_destroy(MultiQueue* mq);
+
+void multiqueue_push(MultiQueue* mq, uint64_t* rng, long long key, int value);
+
+// Returns 1 and the popped item, or 0 if every heap looked empty (other
+// threads may still be pushing).
+int  multiqueue_pop(MultiQueue* mq, uint64_t* rng, PQItem* out);
+
+#endif
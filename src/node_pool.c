@@ -0,0 +1,80 @@
+// node_pool.c
+#include "node_pool.h"
+#include <stdlib.h>
+
+#define POOL_ALIGN 16
+#define POOL_MIN_NODES 64
+
+struct PoolChunk {
+    PoolChunk* next;
+};
+
+// Slab data starts after the header, rounded up to POOL_ALIGN
+#define CHUNK_HEADER (((sizeof(PoolChunk) + POOL_ALIGN - 1) / POOL_ALIGN) * POOL_ALIGN)
+
+void node_pool_init(NodePool* pool, size_t node_size, int capacity) {
+    if (node_size < sizeof(void*)) node_size = sizeof(void*);
+    pool->node_size = ((node_size + POOL_ALIGN - 1) / POOL_ALIGN) * POOL_ALIGN;
+    pool->next_chunk_nodes = capacity > POOL_MIN_NODES ? (size_t)capacity : POOL_MIN_NODES;
+    pool->free_list = NULL;
+    pool->bump = pool->bump_end = NULL;
+    pool->chunks = NULL;
+}
+
+static int node_pool_grow(NodePool* pool) {
+    size_t bytes = pool->next_chunk_nodes * pool->node_size;
+    PoolChunk* c = (PoolChunk*)malloc(CHUNK_HEADER + bytes);
+    if (!c) return 0;
+    c->next = pool->chunks;
+    pool->chunks = c;
+    pool->bump = (char*)c + CHUNK_HEADER;
+    pool->bump_end = pool->bump + bytes;
+    pool->next_chunk_nodes *= 2;
+    return 1;
+}
+
+void* node_pool_alloc(NodePool* pool) {
+    if (pool->free_list) {
+        void* node = pool->free_list;
+        pool->free_list = *(void**)node;
+        return node;
+    }
+    if (pool->bump == pool->bump_end && !node_pool_grow(pool)) return NULL;
+    void* node = pool->bump;
+    pool->bump += pool->node_size;
+    return node;
+}
+
+void node_pool_free(NodePool* pool, void* node) {
+    *(void**)node = pool->free_list;
+    pool->free_list = node;
+}
+
+void node_pool_release(NodePool* pool) {
+    PoolChunk* c = pool->chunks;
+    while (c) {
+        PoolChunk* nxt = c->next;
+        free(c);
+        c = nxt;
+    }
+    pool->chunks = NULL;
+    pool->free_list = NULL;
+    pool->bump = pool->bump_end = NULL;
+}
+
+void node_pool_reset(NodePool* pool) {
+    // The newest slab is the largest; keep it and free the older ones
+    PoolChunk* keep = pool->chunks;
+    if (!keep) return;
+    PoolChunk* c = keep->next;
+    while (c) {
+        PoolChunk* nxt = c->next;
+        free(c);
+        c = nxt;
+    }
+    keep->next = NULL;
+    size_t keep_nodes = pool->next_chunk_nodes / 2;
+    pool->free_list = NULL;
+    pool->bump = (char*)keep + CHUNK_HEADER;
+    pool->bump_end = pool->bump + keep_nodes * pool->node_size;
+}
@@ -0,0 +1,28 @@
+// node_pool.h
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <stddef.h>
+
+// Per-heap slab allocator for fixed-size nodes (used by the Fibonacci and
+// pairing heaps). The first slab is sized from the heap's capacity hint;
+// further slabs double in size. Freed nodes go on an intrusive free list and
+// are reused before any new slab space; release drops every slab at once.
+typedef struct PoolChunk PoolChunk;
+
+typedef struct {
+    size_t node_size;
+    size_t next_chunk_nodes; // size of the next slab, in nodes
+    void* free_list;         // recycled nodes (first word links to the next)
+    char* bump;              // unused space in the newest slab
+    char* bump_end;
+    PoolChunk* chunks;
+} NodePool;
+
+void  node_pool_init(NodePool* pool, size_t node_size, int capacity);
+void* node_pool_alloc(NodePool* pool);
+void  node_pool_free(NodePool* pool, void* node);
+void  node_pool_release(NodePool* pool); // frees all nodes and slabs
+void  node_pool_reset(NodePool* pool);   // drops all nodes, keeps the largest slab for reuse
+
+#endif
@@ -1,4 +1,5 @@
 #include "pairing_pq.h"
+#include "node_pool.h"
 #include <stdlib.h>
 
 typedef struct PairNode {
@@ -11,6 +12,7 @@ typedef struct PairNode {
 
 struct PQ {
     PairNode *root;
+    NodePool pool; // node slabs, recycled on extract
 };
 
 /* meld two heaps — smaller key wins and gets the other as child */
@@ -77,28 +79,23 @@ static PairNode *two_pass_pair(PairNode *list) {
 }
 
 static PQ *pairing_create(int capacity) {
-    (void)capacity;
     PQ *pq = malloc(sizeof(PQ));
-    if (pq) pq->root = NULL;
+    if (pq) {
+        pq->root = NULL;
+        node_pool_init(&pq->pool, sizeof(PairNode), capacity);
+    }
     return pq;
 }
 
-static void free_heap(PairNode *node) {
-    if (!node) return;
-    free_heap(node->child);
-    free_heap(node->sibling);
-    free(node);
-}
-
 static void pairing_destroy(PQ *pq) {
     if (pq) {
-        free_heap(pq->root);
+        node_pool_release(&pq->pool);
         free(pq);
     }
 }
 
 static PQHandle *pairing_insert(PQ *pq, long long key, int value) {
-    PairNode *n = malloc(sizeof(PairNode));
+    PairNode *n = node_pool_alloc(&pq->pool);
     if (!n) return NULL;
 
     n->key = key;
@@ -109,6 +106,34 @@ static PQHandle *pairing_insert(PQ *pq, long long key, int value) {
     return (PQHandle *)n;
 }
 
+/* bulk build: meld items pairwise in rounds (multipass pairing), O(count) */
+static void pairing_build(PQ *pq, const PQItem *items, int count, PQHandle **handles) {
+    if (count <= 0) return;
+    PairNode **level = malloc(sizeof(PairNode *) * (size_t)count);
+    if (!level) abort();
+
+    for (int i = 0; i < count; i++) {
+        PairNode *n = node_pool_alloc(&pq->pool);
+        if (!n) abort();
+        n->key = items[i].key;
+        n->value = items[i].value;
+        n->child = n->sibling = n->prev = NULL;
+        level[i] = n;
+        if (handles) handles[i] = (PQHandle *)n;
+    }
+
+    int len = count;
+    while (len > 1) {
+        int out = 0;
+        for (int i = 0; i + 1 < len; i += 2) level[out++] = meld(level[i], level[i + 1]);
+        if (len & 1) level[out++] = level[len - 1];
+        len = out;
+    }
+
+    pq->root = meld(pq->root, level[0]);
+    free(level);
+}
+
 static PQItem pairing_extract_min(PQ *pq) {
     PQItem item = {0, 0};
     if (!pq->root) return item;
@@ -119,7 +144,7 @@ static PQItem pairing_extract_min(PQ *pq) {
     PairNode *kids = pq->root->child;
     if (kids) kids->prev = NULL;
 
-    free(pq->root);
+    node_pool_free(&pq->pool, pq->root);
     pq->root = two_pass_pair(kids);
 
     return item;
@@ -151,11 +176,18 @@ static int pairing_is_empty(PQ *pq) {
     return pq->root == NULL;
 }
 
+static void pairing_clear(PQ *pq) {
+    node_pool_reset(&pq->pool);
+    pq->root = NULL;
+}
+
 PQOps pairing_pq_ops = {
     .create       = pairing_create,
     .destroy      = pairing_destroy,
     .insert       = pairing_insert,
     .extract_min  = pairing_extract_min,
     .decrease_key = pairing_decrease_key,
-    .is_empty     = pairing_is_empty
+    .build        = pairing_build,
+    .is_empty     = pairing_is_empty,
+    .clear        = pairing_clear
 };
\ No newline at end of file
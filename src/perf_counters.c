@@ -0,0 +1,119 @@
+// perf_counters.c
+#include "perf_counters.h"
+#include <string.h>
+
+static const char* COUNTER_NAMES[PERF_COUNTER_COUNT] = {
+    "cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses"
+};
+
+const char* perf_counter_name(int id) {
+    return id >= 0 && id < PERF_COUNTER_COUNT ? COUNTER_NAMES[id] : "?";
+}
+
+int perf_sample_delta(const PerfSample* a, const PerfSample* b, uint64_t out[PERF_COUNTER_COUNT]) {
+    uint64_t enabled = b->enabled - a->enabled;
+    uint64_t running = b->running - a->running;
+    if (running == 0 && enabled > 0) {
+        memset(out, 0, sizeof(uint64_t) * PERF_COUNTER_COUNT);
+        return -1;
+    }
+    for (int i = 0; i < PERF_COUNTER_COUNT; i++) out[i] = b->value[i] - a->value[i];
+    if (running >= enabled) return 1;
+    double scale = (double)enabled / (double)running;
+    for (int i = 0; i < PERF_COUNTER_COUNT; i++) out[i] = (uint64_t)((double)out[i] * scale + 0.5);
+    return 0;
+}
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+static int open_event(uint32_t type, uint64_t config, int group_fd) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = group_fd < 0; // the leader starts the whole group
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED
+                       | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0);
+}
+
+int perf_counters_open(PerfCounters* pc) {
+    static const struct { uint32_t type; uint64_t config; } EVENTS[PERF_COUNTER_COUNT] = {
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+        { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                                  | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+    };
+
+    pc->leader = -1;
+    pc->opened = 0;
+    pc->mask = 0;
+    for (int i = 0; i < PERF_COUNTER_COUNT; i++) {
+        pc->slot[i] = -1;
+        pc->fd[i] = open_event(EVENTS[i].type, EVENTS[i].config, pc->leader);
+        if (pc->fd[i] < 0) continue;
+        if (pc->leader < 0) pc->leader = pc->fd[i];
+        pc->slot[i] = pc->opened++;
+        pc->mask |= 1u << i;
+    }
+
+    if (pc->leader >= 0) {
+        ioctl(pc->leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(pc->leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+    return pc->opened;
+}
+
+void perf_counters_close(PerfCounters* pc) {
+    for (int i = 0; i < PERF_COUNTER_COUNT; i++) {
+        if (pc->fd[i] >= 0) close(pc->fd[i]);
+        pc->fd[i] = -1;
+    }
+    pc->leader = -1;
+    pc->opened = 0;
+    pc->mask = 0;
+}
+
+void perf_counters_read(const PerfCounters* pc, PerfSample* out) {
+    uint64_t buf[3 + PERF_COUNTER_COUNT]; // { nr, time_enabled, time_running, values in slot order }
+    memset(out, 0, sizeof(*out));
+    if (pc->leader < 0) return;
+    if (read(pc->leader, buf, sizeof(uint64_t) * (size_t)(3 + pc->opened)) <= 0) return;
+    out->enabled = buf[1];
+    out->running = buf[2];
+    for (int i = 0; i < PERF_COUNTER_COUNT; i++)
+        if (pc->slot[i] >= 0 && (uint64_t)pc->slot[i] < buf[0]) out->value[i] = buf[3 + pc->slot[i]];
+}
+
+#else
+
+int perf_counters_open(PerfCounters* pc) {
+    for (int i = 0; i < PERF_COUNTER_COUNT; i++) {
+        pc->fd[i] = -1;
+        pc->slot[i] = -1;
+    }
+    pc->leader = -1;
+    pc->opened = 0;
+    pc->mask = 0;
+    return 0;
+}
+
+void perf_counters_close(PerfCounters* pc) {
+    (void)pc;
+}
+
+void perf_counters_read(const PerfCounters* pc, PerfSample* out) {
+    (void)pc;
+    memset(out, 0, sizeof(*out));
+}
+
+#endif
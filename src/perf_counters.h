@@ -0,0 +1,55 @@
+// perf_counters.h
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <stdint.h>
+
+// Hardware event counters of the calling thread (user space only), read via
+// Linux perf_event_open. Each event is opened on its own and joined to one
+// group, so unsupported events (common in VMs) are simply left out; on other
+// platforms, or when perf_event_paranoid forbids access, nothing opens.
+typedef enum {
+    PERF_CYCLES,
+    PERF_INSTRUCTIONS,
+    PERF_L1D_MISSES,
+    PERF_LLC_MISSES,
+    PERF_BRANCH_MISSES,
+    PERF_COUNTER_COUNT
+} PerfCounterId;
+
+typedef struct {
+    int fd[PERF_COUNTER_COUNT];   // -1 if the event is unavailable
+    int slot[PERF_COUNTER_COUNT]; // position of the event in a group read
+    int leader;                   // group leader fd, -1 if nothing opened
+    int opened;
+    unsigned mask;                // bit i set: counter i is live
+} PerfCounters;
+
+// Returns the number of counters opened (0: unavailable, pc stays usable).
+int  perf_counters_open(PerfCounters* pc);
+void perf_counters_close(PerfCounters* pc);
+
+// One group read: raw counter values plus the time the group was enabled and
+// actually counting. When the PMU multiplexes the group (more events than
+// hardware counters, or other users of the PMU), running < enabled and the
+// raw values undercount.
+typedef struct {
+    uint64_t value[PERF_COUNTER_COUNT]; // unavailable counters read as 0
+    uint64_t enabled;                   // ns
+    uint64_t running;                   // ns
+} PerfSample;
+
+// Current counters in one syscall (a few hundred ns; callers time their work
+// inside the two reads).
+void perf_counters_read(const PerfCounters* pc, PerfSample* out);
+
+// Counts between samples a and b into out. Returns 1 if the group counted the
+// whole interval, 0 if it was multiplexed and the counts were scaled by
+// enabled / running (estimates), -1 if it never ran in between (out zeroed:
+// the counts are unknown, not zero).
+int  perf_sample_delta(const PerfSample* a, const PerfSample* b, uint64_t out[PERF_COUNTER_COUNT]);
+
+// Short column-style name, e.g. "cycles", "llc_misses".
+const char* perf_counter_name(int id);
+
+#endif
@@ -3,6 +3,7 @@
 #define PQ_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 typedef struct PQ PQ;           // opaque
 typedef struct PQHandle PQHandle; // opaque handle type
@@ -13,15 +14,46 @@ typedef struct {
 } PQItem;
 
 // Function table (like an interface in C)
-typedef struct {
+typedef struct PQOps PQOps;
+struct PQOps {
     PQ*      (*create)(int capacity);
     void     (*destroy)(PQ* pq);
 
-    PQHandle*(*insert)(PQ* pq, long long key, int value); // returns handle for decrease-key
+    // Returns handle for decrease-key. Inserting a value that is already queued
+    // is backend-specific, see PQ_HANDLE_FROM_VERTEX.
+    PQHandle*(*insert)(PQ* pq, long long key, int value);
     PQItem   (*extract_min)(PQ* pq);                      // removes/returns min
     void     (*decrease_key)(PQ* pq, PQHandle* h, long long new_key);
 
+    // Batch insert of `count` items, writing the handle of items[i] to handles[i]
+    // (handles may be NULL). On an empty heap this is a bulk build, implemented
+    // natively per backend (e.g. linear-time heapify).
+    void     (*build)(PQ* pq, const PQItem* items, int count, PQHandle** handles);
+
     int      (*is_empty)(PQ* pq);
-} PQOps;
+
+    // Removes all items but keeps the heap's memory, so one PQ can serve many runs.
+    // Handles returned before the clear become invalid.
+    void     (*clear)(PQ* pq);
+
+    // Optional: create with access to the ops table itself, for wrappers whose
+    // table carries per-instance state (e.g. pq_profile). NULL: use create.
+    PQ*      (*create_with)(const PQOps* self, int capacity);
+};
+
+// Creates a heap through `ops`; use this rather than ops->create so that
+// context-carrying tables work.
+static inline PQ* pq_create(const PQOps* ops, int capacity) {
+    return ops->create_with ? ops->create_with(ops, capacity) : ops->create(capacity);
+}
+
+// Vertex-indexed backends (keys live in arrays indexed by vertex id) have no
+// per-item node, so the handle simply encodes the vertex id. +1 keeps it non-NULL.
+// They also hold at most one entry per vertex: inserting a queued vertex
+// keeps the smaller of the two keys (a decrease-key, or a no-op for a larger
+// key). Node-based heaps (binary, Fibonacci, pairing) keep both entries, so
+// callers that insert duplicates (the lazy modes) must skip stale pops.
+#define PQ_HANDLE_FROM_VERTEX(v) ((PQHandle*)(intptr_t)((v) + 1))
+#define PQ_HANDLE_TO_VERTEX(h)   ((int)((intptr_t)(h) - 1))
 
 #endif
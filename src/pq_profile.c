@@ -1,104 +1,197 @@
 #include "pq_profile.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
-#ifdef _WIN32
-#include <windows.h>
-static uint64_t now_ns(void) {
-    static LARGE_INTEGER freq;
-    static int init = 0;
-    if (!init) { QueryPerformanceFrequency(&freq); init = 1; }
-    LARGE_INTEGER t;
-    QueryPerformanceCounter(&t);
-    // convert ticks to ns
-    return (uint64_t)((1e9 * (double)t.QuadPart) / (double)freq.QuadPart);
-}
-#else
-#include <time.h>
-static uint64_t now_ns(void) {
-    struct timespec ts;
-    clock_gettime(CLOCK_MONOTONIC, &ts);
-    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
-}
-#endif
+#include "timer.h"
 
 typedef struct {
     PQProfile *prof;
+    const PQOps *base;
     PQ *inner;
 } ProfilePQ;
 
 static PQ *p_create(int cap);
+static PQ *p_create_with(const PQOps *self, int cap);
 static void p_destroy(PQ *pq);
 static PQHandle *p_insert(PQ *pq, long long key, int value);
 static PQItem p_extract_min(PQ *pq);
 static void p_decrease_key(PQ *pq, PQHandle *h, long long new_key);
+static void p_build(PQ *pq, const PQItem *items, int count, PQHandle **handles);
 static int p_is_empty(PQ *pq);
+static void p_clear(PQ *pq);
 
-static PQOps WRAP_OPS = {
+static const PQOps WRAP_OPS = {
     .create = p_create,
+    .create_with = p_create_with,
     .destroy = p_destroy,
     .insert = p_insert,
     .extract_min = p_extract_min,
     .decrease_key = p_decrease_key,
-    .is_empty = p_is_empty
+    .build = p_build,
+    .is_empty = p_is_empty,
+    .clear = p_clear
 };
 
-static const PQOps *G_BASE = NULL;
-static PQProfile *G_PROF = NULL;
-
 const PQOps *pq_profile_ops(const PQOps *base_ops, PQProfile *prof) {
-    G_BASE = base_ops;
-    G_PROF = prof;
+    prof->ops = WRAP_OPS;
     prof->base = base_ops;
-    return &WRAP_OPS;
+    return &prof->ops;
 }
 
 void pq_profile_reset(PQProfile *prof) {
+    PQOps ops = prof->ops;
+    const PQOps *base = prof->base;
     memset(prof, 0, sizeof(*prof));
+    prof->ops = ops;
+    prof->base = base;
+}
+
+void pq_profile_merge(PQProfile *dst, const PQProfile *src) {
+    dst->insert_count += src->insert_count;
+    dst->extract_count += src->extract_count;
+    dst->decrease_count += src->decrease_count;
+    dst->build_count += src->build_count;
+    dst->insert_ns += src->insert_ns;
+    dst->extract_ns += src->extract_ns;
+    dst->decrease_ns += src->decrease_ns;
+    dst->build_ns += src->build_ns;
+    for (int op = 0; op < PQ_OP_COUNT; op++) {
+        dst->sampled[op] += src->sampled[op];
+        latency_hist_merge(&dst->hist[op], &src->hist[op]);
+        for (int i = 0; i < PERF_COUNTER_COUNT; i++) dst->hw[op][i] += src->hw[op][i];
+    }
+    dst->hw_scaled += src->hw_scaled;
+    dst->hw_missed += src->hw_missed;
+}
+
+void pq_profile_attach_counters(PQProfile *prof, const PerfCounters *perf) {
+    prof->perf = perf && perf->opened > 0 ? perf : NULL;
+}
+
+void pq_profile_set_timing(PQProfile *prof, const TscClock *tsc, unsigned sample_every) {
+    prof->use_tsc = tsc != NULL;
+    if (tsc) prof->tsc = *tsc;
+    prof->sample_every = sample_every > 1 ? sample_every : 1;
+    prof->sample_tick = 0;
+}
+
+// State of one operation between op_begin and op_end
+typedef struct {
+    int timed;
+    uint64_t t0;
+    PerfSample c0;
+} OpTiming;
+
+// Counter reads bracket the timed region, so ns excludes the read syscalls
+static inline void op_begin(PQProfile *prof, int op, OpTiming *ot) {
+    ot->timed = 1;
+    if (prof->sample_every > 1 && op != PQ_OP_BUILD) {
+        if (++prof->sample_tick < prof->sample_every) {
+            ot->timed = 0;
+            return;
+        }
+        prof->sample_tick = 0;
+    }
+    if (prof->perf) perf_counters_read(prof->perf, &ot->c0);
+    ot->t0 = prof->use_tsc ? tsc_read() : now_ns();
+}
+
+// Returns the estimated ns to add to the operation's sum
+static inline uint64_t op_end(PQProfile *prof, int op, const OpTiming *ot) {
+    if (!ot->timed) return 0;
+    uint64_t ns;
+    if (prof->use_tsc) {
+        uint64_t d = tsc_read() - ot->t0;
+        d = d > prof->tsc.overhead_ticks ? d - prof->tsc.overhead_ticks : 0;
+        ns = (uint64_t)((double)d * prof->tsc.ns_per_tick + 0.5);
+    } else {
+        ns = now_ns() - ot->t0;
+    }
+    if (prof->perf) {
+        PerfSample c1;
+        uint64_t d[PERF_COUNTER_COUNT];
+        perf_counters_read(prof->perf, &c1);
+        int exact = perf_sample_delta(&ot->c0, &c1, d);
+        if (exact < 0) prof->hw_missed++;
+        else if (exact == 0) prof->hw_scaled++;
+        for (int i = 0; i < PERF_COUNTER_COUNT; i++) prof->hw[op][i] += d[i];
+    }
+    prof->sampled[op]++;
+    latency_hist_add(&prof->hist[op], ns);
+    return op == PQ_OP_BUILD ? ns : ns * prof->sample_every;
 }
 
 static PQ *p_create(int cap) {
+    (void)cap;
+    fprintf(stderr, "pq_profile: profiled heaps must be created with pq_create()\n");
+    exit(1);
+}
+
+static PQ *p_create_with(const PQOps *self, int cap) {
+    PQProfile *prof = (PQProfile*)((const char*)self - offsetof(PQProfile, ops));
     ProfilePQ *ppq = (ProfilePQ*)malloc(sizeof(ProfilePQ));
-    ppq->prof = G_PROF;
-    ppq->inner = G_BASE->create(cap);
+    ppq->prof = prof;
+    ppq->base = prof->base;
+    ppq->inner = pq_create(prof->base, cap);
     return (PQ*)ppq;
 }
 
 static void p_destroy(PQ *pq) {
     ProfilePQ *ppq = (ProfilePQ*)pq;
-    G_BASE->destroy(ppq->inner);
+    ppq->base->destroy(ppq->inner);
     free(ppq);
 }
 
 static PQHandle *p_insert(PQ *pq, long long key, int value) {
     ProfilePQ *ppq = (ProfilePQ*)pq;
-    uint64_t t0 = now_ns();
-    PQHandle *h = G_BASE->insert(ppq->inner, key, value);
-    uint64_t t1 = now_ns();
+    OpTiming ot;
+    op_begin(ppq->prof, PQ_OP_INSERT, &ot);
+    PQHandle *h = ppq->base->insert(ppq->inner, key, value);
+    uint64_t ns = op_end(ppq->prof, PQ_OP_INSERT, &ot);
     ppq->prof->insert_count++;
-    ppq->prof->insert_ns += (t1 - t0);
+    ppq->prof->insert_ns += ns;
     return h;
 }
 
 static PQItem p_extract_min(PQ *pq) {
     ProfilePQ *ppq = (ProfilePQ*)pq;
-    uint64_t t0 = now_ns();
-    PQItem it = G_BASE->extract_min(ppq->inner);
-    uint64_t t1 = now_ns();
+    OpTiming ot;
+    op_begin(ppq->prof, PQ_OP_EXTRACT, &ot);
+    PQItem it = ppq->base->extract_min(ppq->inner);
+    uint64_t ns = op_end(ppq->prof, PQ_OP_EXTRACT, &ot);
     ppq->prof->extract_count++;
-    ppq->prof->extract_ns += (t1 - t0);
+    ppq->prof->extract_ns += ns;
     return it;
 }
 
 static void p_decrease_key(PQ *pq, PQHandle *h, long long new_key) {
     ProfilePQ *ppq = (ProfilePQ*)pq;
-    uint64_t t0 = now_ns();
-    G_BASE->decrease_key(ppq->inner, h, new_key);
-    uint64_t t1 = now_ns();
+    OpTiming ot;
+    op_begin(ppq->prof, PQ_OP_DECREASE, &ot);
+    ppq->base->decrease_key(ppq->inner, h, new_key);
+    uint64_t ns = op_end(ppq->prof, PQ_OP_DECREASE, &ot);
     ppq->prof->decrease_count++;
-    ppq->prof->decrease_ns += (t1 - t0);
+    ppq->prof->decrease_ns += ns;
+}
+
+static void p_build(PQ *pq, const PQItem *items, int count, PQHandle **handles) {
+    ProfilePQ *ppq = (ProfilePQ*)pq;
+    OpTiming ot;
+    op_begin(ppq->prof, PQ_OP_BUILD, &ot);
+    ppq->base->build(ppq->inner, items, count, handles);
+    uint64_t ns = op_end(ppq->prof, PQ_OP_BUILD, &ot);
+    ppq->prof->build_count += (uint64_t)count;
+    ppq->prof->build_ns += ns;
 }
 
 static int p_is_empty(PQ *pq) {
     ProfilePQ *ppq = (ProfilePQ*)pq;
-    return G_BASE->is_empty(ppq->inner);
+    return ppq->base->is_empty(ppq->inner);
+}
+
+static void p_clear(PQ *pq) {
+    ProfilePQ *ppq = (ProfilePQ*)pq;
+    ppq->base->clear(ppq->inner);
 }
@@ -1,21 +1,72 @@
 #pragma once
 #include "pq.h"
+#include "perf_counters.h"
+#include "latency_hist.h"
+#include "tsc_clock.h"
 #include <stdint.h>
 
+// Operation types for the per-operation counters and histograms
+enum { PQ_OP_INSERT, PQ_OP_EXTRACT, PQ_OP_DECREASE, PQ_OP_BUILD, PQ_OP_COUNT };
+
+// One profile per thread (or per heap): the wrapper ops table lives inside the
+// profile, so heaps created through it find their counters without any global
+// state, and concurrent profiles never share a cache line on the hot path.
+// Aggregate per-thread profiles afterwards with pq_profile_merge.
 typedef struct {
+    PQOps ops;             // wrapper table bound to this profile (pq_profile_ops)
     const PQOps *base;     // underlying ops (bin/fib/pair)
     uint64_t insert_count;
     uint64_t extract_count;
     uint64_t decrease_count;
+    uint64_t build_count;   // items passed to build
 
     uint64_t insert_ns;
     uint64_t extract_ns;
     uint64_t decrease_ns;
+    uint64_t build_ns;
+
+    // Timing mode (see pq_profile_set_timing). With sampling the *_ns sums are
+    // estimates: each timed operation counts sample_every times.
+    int use_tsc;
+    TscClock tsc;
+    unsigned sample_every;          // 0 or 1: time every operation
+    unsigned sample_tick;
+    uint64_t sampled[PQ_OP_COUNT];  // operations actually timed
+    LatencyHist hist[PQ_OP_COUNT];  // per-operation latency in ns (timed ops only)
+
+    // Optional hardware counters (see pq_profile_attach_counters): hw[op][counter]
+    // sums the counter deltas around each operation. Only counters whose bit
+    // is set in perf->mask are meaningful. If the PMU multiplexed the group
+    // during an operation its deltas are scaled up (hw_scaled counts those
+    // operations); if the group did not run at all they are left out
+    // (hw_missed), so hw then undercounts.
+    const PerfCounters *perf;
+    uint64_t hw[PQ_OP_COUNT][PERF_COUNTER_COUNT];
+    uint64_t hw_scaled;
+    uint64_t hw_missed;
 } PQProfile;
 
 // Returns an ops table that wraps `base_ops` and records timing into `prof`.
+// Heaps must be created with pq_create() on the returned table.
 // NOTE: prof must outlive the run.
 const PQOps *pq_profile_ops(const PQOps *base_ops, PQProfile *prof);
 
-// Reset counters/timers
+// Reset counters/timers (also detaches hardware counters and returns to
+// clock_gettime timing of every operation). An ops table returned earlier
+// stays bound to prof.
 void pq_profile_reset(PQProfile *prof);
+
+// Adds the counts, sums, histograms and hardware counters of src to dst
+// (e.g. per-thread profiles into a total once the threads are done).
+void pq_profile_merge(PQProfile *dst, const PQProfile *src);
+
+// Low-overhead mode: time with calibrated cycle-counter reads (tsc != NULL;
+// the calibrated empty-read cost is subtracted from every sample) and/or only
+// every sample_every-th insert/extract/decrease (build is always timed).
+// Call after pq_profile_reset.
+void pq_profile_set_timing(PQProfile *prof, const TscClock *tsc, unsigned sample_every);
+
+// Also collect hardware counters per operation type from `perf` (opened by the
+// caller on the thread that runs the heap; NULL or nothing opened: wall clock
+// only). Each operation then costs two extra counter reads.
+void pq_profile_attach_counters(PQProfile *prof, const PerfCounters *perf);
@@ -1,11 +1,13 @@
 // prim.c
 #include "prim.h"
+#include "lazy_heap.h"
+#include "min_scan.h"
 #include <stdlib.h>
 #include <limits.h>
 
 #define INF (LLONG_MAX/4)
 
-PrimResult prim_run(const Graph* g, int root, const PQOps* ops) {
+PrimResult prim_run_heap(const Graph* g, int root, const PQOps* ops) {
     int n = g->n;
     long long* key = (long long*)malloc(sizeof(long long)*n);
     int* parent = (int*)malloc(sizeof(int)*n);
@@ -15,10 +17,11 @@ PrimResult prim_run(const Graph* g, int root, const PQOps* ops) {
     for (int i=0;i<n;i++){ key[i]=INF; parent[i]=-1; }
     key[root]=0;
 
-    PQ* pq = ops->create(n);
-    for (int v=0; v<n; v++) {
-        handle[v] = ops->insert(pq, key[v], v);
-    }
+    PQ* pq = pq_create(ops, n);
+    PQItem* items = (PQItem*)malloc(sizeof(PQItem)*n);
+    for (int v=0; v<n; v++) { items[v].key = key[v]; items[v].value = v; }
+    ops->build(pq, items, n, handle);
+    free(items);
 
     long long total = 0;
 
@@ -52,6 +55,248 @@ PrimResult prim_run(const Graph* g, int root, const PQOps* ops) {
     return r;
 }
 
+PrimResult prim_run(const Graph* g, int root, const PQOps* ops) {
+    return prim_run_heap(g, root, ops);
+}
+
+// Dense Prim state: key[v] is the lightest edge from the tree to v, and
+// PRIM_NO_EDGE for unreached and in-tree vertices so the scan needs no flags.
+// state[v] (DENSE_*) tells the cases apart, since an adjacency-list edge may
+// itself weigh PRIM_NO_EDGE.
+enum { DENSE_UNREACHED, DENSE_REACHED, DENSE_IN_TREE };
+
+static int* dense_init(int n, int root, int** parent, char** state) {
+    int* key = (int*)malloc(sizeof(int)*n);
+    *parent = (int*)malloc(sizeof(int)*n);
+    *state = (char*)calloc(n, 1);
+    for (int i=0;i<n;i++){ key[i]=PRIM_NO_EDGE; (*parent)[i]=-1; }
+    key[root]=0;
+    (*state)[root]=DENSE_REACHED;
+    return key;
+}
+
+PrimResult prim_run_dense(const Graph* g, int root) {
+    int n = g->n;
+    int* parent;
+    char* state;
+    int* key = dense_init(n, root, &parent, &state);
+    long long total = 0;
+
+    for (int it=0; it<n; it++) {
+        int u = min_scan_i32(key, n);
+        if (key[u] == PRIM_NO_EDGE) {
+            // Only PRIM_NO_EDGE keys left: any reached vertex is a minimum
+            for (u = 0; u < n && state[u] != DENSE_REACHED; u++) {}
+            if (u == n) break;               // disconnected graph
+        }
+        total += key[u];
+        key[u] = PRIM_NO_EDGE;
+        state[u] = DENSE_IN_TREE;
+
+        for (Edge* e = g->adj[u]; e; e = e->next) {
+            int v = e->to;
+            if (state[v] == DENSE_IN_TREE) continue;
+            if (state[v] == DENSE_UNREACHED || e->w < key[v]) {
+                key[v] = e->w;
+                parent[v] = u;
+                state[v] = DENSE_REACHED;
+            }
+        }
+    }
+
+    free(key);
+    free(state);
+
+    PrimResult r = { total, parent };
+    return r;
+}
+
+// Matrix weights are below PRIM_NO_EDGE, so the key alone marks reached vertices
+PrimResult prim_run_matrix(const int* w, int n, int root) {
+    int* parent;
+    char* state;
+    int* key = dense_init(n, root, &parent, &state);
+    long long total = 0;
+
+    for (int it=0; it<n; it++) {
+        int u = min_scan_i32(key, n);
+        if (key[u] == PRIM_NO_EDGE) break;   // disconnected graph
+        total += key[u];
+        key[u] = PRIM_NO_EDGE;
+        state[u] = DENSE_IN_TREE;
+
+        const int* row = w + (size_t)u * n;
+        for (int v=0; v<n; v++) {
+            if (state[v] != DENSE_IN_TREE && row[v] < key[v]) {
+                key[v] = row[v];
+                parent[v] = u;
+            }
+        }
+    }
+
+    free(key);
+    free(state);
+
+    PrimResult r = { total, parent };
+    return r;
+}
+
+// Same algorithm over the frozen CSR layout.
+PrimResult prim_run_csr(const CSRGraph* g, int root, const PQOps* ops) {
+    int n = g->n;
+    long long* key = (long long*)malloc(sizeof(long long)*n);
+    int* parent = (int*)malloc(sizeof(int)*n);
+    int* in_mst = (int*)calloc(n, sizeof(int));
+    PQHandle** handle = (PQHandle**)malloc(sizeof(PQHandle*)*n);
+
+    for (int i=0;i<n;i++){ key[i]=INF; parent[i]=-1; }
+    key[root]=0;
+
+    PQ* pq = pq_create(ops, n);
+    PQItem* items = (PQItem*)malloc(sizeof(PQItem)*n);
+    for (int v=0; v<n; v++) { items[v].key = key[v]; items[v].value = v; }
+    ops->build(pq, items, n, handle);
+    free(items);
+
+    const int* off = g->offsets;
+    const int* to = g->targets;
+    const int* wt = g->weights;
+    long long total = 0;
+
+    while (!ops->is_empty(pq)) {
+        PQItem it = ops->extract_min(pq);
+        int u = it.value;
+        long long ku = it.key;
+
+        if (in_mst[u]) continue;
+        in_mst[u] = 1;
+
+        if (ku == INF) break;          // disconnected graph
+        total += ku;
+
+        for (int k = off[u]; k < off[u+1]; k++) {
+            int v = to[k];
+            if (!in_mst[v] && wt[k] < key[v]) {
+                key[v] = wt[k];
+                parent[v] = u;
+                ops->decrease_key(pq, handle[v], key[v]);
+            }
+        }
+    }
+
+    ops->destroy(pq);
+    free(key);
+    free(in_mst);
+    free(handle);
+
+    PrimResult r = { total, parent };
+    return r;
+}
+
+// Lazy insertion: start from the root alone and queue (w, v) whenever an edge
+// improves key[v]; pops of vertices already in the tree or with an outdated
+// key are skipped. Spans the root's component, like prim_run.
+PrimResult prim_run_lazy(const Graph* g, int root, const PQOps* ops) {
+    int n = g->n;
+    long long* key = (long long*)malloc(sizeof(long long)*n);
+    int* parent = (int*)malloc(sizeof(int)*n);
+    int* in_mst = (int*)calloc(n, sizeof(int));
+
+    for (int i=0;i<n;i++){ key[i]=INF; parent[i]=-1; }
+    key[root]=0;
+
+    LazyHeap lh;
+    PQ* pq = NULL;
+    if (ops) {
+        pq = pq_create(ops, n);
+        ops->insert(pq, 0, root);
+    } else {
+        lazy_heap_init(&lh, n);
+        lazy_heap_push(&lh, 0, root);
+    }
+
+    long long total = 0;
+
+    while (ops ? !ops->is_empty(pq) : lh.size > 0) {
+        PQItem it = ops ? ops->extract_min(pq) : lazy_heap_pop(&lh);
+        int u = it.value;
+
+        if (in_mst[u] || it.key != key[u]) continue;
+        in_mst[u] = 1;
+        total += it.key;
+
+        for (Edge* e = g->adj[u]; e; e = e->next) {
+            int v = e->to;
+            if (!in_mst[v] && e->w < key[v]) {
+                key[v] = e->w;
+                parent[v] = u;
+                if (ops) ops->insert(pq, key[v], v);
+                else lazy_heap_push(&lh, key[v], v);
+            }
+        }
+    }
+
+    if (ops) ops->destroy(pq);
+    else lazy_heap_free(&lh);
+    free(key);
+    free(in_mst);
+
+    PrimResult r = { total, parent };
+    return r;
+}
+
+PrimResult prim_run_lazy_csr(const CSRGraph* g, int root, const PQOps* ops) {
+    int n = g->n;
+    long long* key = (long long*)malloc(sizeof(long long)*n);
+    int* parent = (int*)malloc(sizeof(int)*n);
+    int* in_mst = (int*)calloc(n, sizeof(int));
+
+    for (int i=0;i<n;i++){ key[i]=INF; parent[i]=-1; }
+    key[root]=0;
+
+    LazyHeap lh;
+    PQ* pq = NULL;
+    if (ops) {
+        pq = pq_create(ops, n);
+        ops->insert(pq, 0, root);
+    } else {
+        lazy_heap_init(&lh, n);
+        lazy_heap_push(&lh, 0, root);
+    }
+
+    const int* off = g->offsets;
+    const int* to = g->targets;
+    const int* wt = g->weights;
+    long long total = 0;
+
+    while (ops ? !ops->is_empty(pq) : lh.size > 0) {
+        PQItem it = ops ? ops->extract_min(pq) : lazy_heap_pop(&lh);
+        int u = it.value;
+
+        if (in_mst[u] || it.key != key[u]) continue;
+        in_mst[u] = 1;
+        total += it.key;
+
+        for (int k = off[u]; k < off[u+1]; k++) {
+            int v = to[k];
+            if (!in_mst[v] && wt[k] < key[v]) {
+                key[v] = wt[k];
+                parent[v] = u;
+                if (ops) ops->insert(pq, key[v], v);
+                else lazy_heap_push(&lh, key[v], v);
+            }
+        }
+    }
+
+    if (ops) ops->destroy(pq);
+    else lazy_heap_free(&lh);
+    free(key);
+    free(in_mst);
+
+    PrimResult r = { total, parent };
+    return r;
+}
+
 void prim_free(PrimResult r) {
     free(r.parent);
 }
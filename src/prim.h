@@ -3,14 +3,38 @@
 #define PRIM_H
 
 #include "graph.h"
+#include "csr_graph.h"
 #include "pq.h"
+#include <limits.h>
+
+// Missing edge in an adjacency matrix, where weights must stay below it
+// (adjacency lists may use any int weight).
+#define PRIM_NO_EDGE INT_MAX
 
 typedef struct {
     long long mst_weight;
     int* parent; // parent[v] in MST, parent[root] = -1
 } PrimResult;
 
+// Heap Prim through `ops` (prim_run_heap). Dense inputs do not switch modes
+// automatically: on adjacency lists the edge walk dominates and the dense
+// scan only breaks even (bench --suite dense), so call prim_run_dense or,
+// with an adjacency matrix, prim_run_matrix explicitly.
 PrimResult prim_run(const Graph* g, int root, const PQOps* ops);
+PrimResult prim_run_heap(const Graph* g, int root, const PQOps* ops);
+PrimResult prim_run_csr(const CSRGraph* g, int root, const PQOps* ops);
+
+// Dense modes: keys and in-tree flags in flat arrays, the next vertex found by
+// a vectorized scan over all keys (min_scan.h). O(n^2 + m), no heap. The
+// matrix form takes row-major n*n weights, PRIM_NO_EDGE where there is no
+// edge (it must be symmetric).
+PrimResult prim_run_dense(const Graph* g, int root);
+PrimResult prim_run_matrix(const int* w, int n, int root);
+
+// Lazy-insertion mode (no decrease-key), see dijkstra_run_lazy; ops NULL uses
+// the compact insert-only heap.
+PrimResult prim_run_lazy(const Graph* g, int root, const PQOps* ops);
+PrimResult prim_run_lazy_csr(const CSRGraph* g, int root, const PQOps* ops);
 void prim_free(PrimResult r);
 
 #endif
@@ -0,0 +1,104 @@
+// query_exec.c
+#include "query_exec.h"
+#include "dijkstra.h"
+#include "thread_team.h"
+#include "timer.h"
+#include <stdlib.h>
+
+struct QueryExecutor {
+    const Graph* g;
+    ThreadTeam* team;
+    DijkstraWorkspace* ws; // one per worker
+
+    // Current batch
+    const int* sources;
+    int count;
+    int next;              // next query index, claimed atomically
+    QueryCallback cb;
+    void* user;
+    uint64_t* latency_ns;  // per query; grown per batch, never per query
+    int latency_cap;
+};
+
+static void exec_task(void* ctx, int tid, int nthreads) {
+    (void)nthreads;
+    QueryExecutor* ex = (QueryExecutor*)ctx;
+    DijkstraWorkspace* ws = &ex->ws[tid];
+    for (;;) {
+        int q = __atomic_fetch_add(&ex->next, 1, __ATOMIC_RELAXED);
+        if (q >= ex->count) break;
+
+        uint64_t t0 = now_ns();
+        dijkstra_run_ws(ex->g, ex->sources[q], ws);
+        ex->latency_ns[q] = now_ns() - t0;  // search only, not the callback
+        if (ex->cb) ex->cb(ex->user, q, ex->sources[q], ws->dist, ws->parent);
+    }
+}
+
+static int cmp_u64(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+    return x < y ? -1 : x > y;
+}
+
+// ops: one table per worker, or NULL to use `shared` for all
+static QueryExecutor* exec_create(const Graph* g, const PQOps* const* ops, const PQOps* shared,
+                                  int num_threads) {
+    QueryExecutor* ex = (QueryExecutor*)malloc(sizeof(QueryExecutor));
+    ex->g = g;
+    ex->team = team_create(num_threads);
+    int T = team_size(ex->team);
+    ex->ws = (DijkstraWorkspace*)malloc(sizeof(DijkstraWorkspace) * (size_t)T);
+    for (int t = 0; t < T; t++) dijkstra_workspace_init(&ex->ws[t], g->n, ops ? ops[t] : shared);
+    ex->latency_ns = NULL;
+    ex->latency_cap = 0;
+    return ex;
+}
+
+QueryExecutor* query_exec_create(const Graph* g, const PQOps* ops, int num_threads) {
+    return exec_create(g, NULL, ops, num_threads);
+}
+
+QueryExecutor* query_exec_create_per_thread(const Graph* g, const PQOps* const* ops, int num_threads) {
+    if (num_threads < 1) num_threads = 1;
+    return exec_create(g, ops, NULL, num_threads);
+}
+
+QueryBatchStats query_exec_run(QueryExecutor* ex, const int* sources, int count,
+                               QueryCallback cb, void* user) {
+    QueryBatchStats st = { count, 0.0, 0.0, 0.0, 0.0 };
+    if (count <= 0) return st;
+
+    if (count > ex->latency_cap) {
+        ex->latency_cap = count;
+        ex->latency_ns = (uint64_t*)realloc(ex->latency_ns, sizeof(uint64_t) * (size_t)count);
+    }
+    ex->sources = sources;
+    ex->count = count;
+    ex->next = 0;
+    ex->cb = cb;
+    ex->user = user;
+
+    uint64_t t0 = now_ns();
+    team_run(ex->team, exec_task, ex);
+    uint64_t total = now_ns() - t0;
+
+    qsort(ex->latency_ns, (size_t)count, sizeof(uint64_t), cmp_u64);
+    int i50 = (count - 1) / 2;
+    int i99 = (int)((long long)count * 99 / 100);
+    if (i99 >= count) i99 = count - 1;
+
+    st.seconds = (double)total / 1e9;
+    st.qps = st.seconds > 0 ? count / st.seconds : 0.0;
+    st.p50_us = (double)ex->latency_ns[i50] / 1e3;
+    st.p99_us = (double)ex->latency_ns[i99] / 1e3;
+    return st;
+}
+
+void query_exec_destroy(QueryExecutor* ex) {
+    int T = team_size(ex->team);
+    team_destroy(ex->team);
+    for (int t = 0; t < T; t++) dijkstra_workspace_free(&ex->ws[t]);
+    free(ex->ws);
+    free(ex->latency_ns);
+    free(ex);
+}
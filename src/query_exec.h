@@ -0,0 +1,35 @@
+// query_exec.h
+#ifndef QUERY_EXEC_H
+#define QUERY_EXEC_H
+
+#include "graph.h"
+#include "pq.h"
+
+// Batched single-source query executor over one read-only Graph. A team of
+// worker threads each owns a preallocated DijkstraWorkspace (dist/parent/handle
+// arrays plus a heap that is cleared, not recreated), so queries run without
+// per-query heap allocation by the executor. Results are handed to a callback
+// on the worker thread; dist/parent are only valid during the callback.
+typedef void (*QueryCallback)(void* user, int query, int source,
+                              const long long* dist, const int* parent);
+
+typedef struct {
+    int queries;
+    double seconds;
+    double qps;
+    double p50_us;  // per-query search latency percentiles (callback excluded)
+    double p99_us;
+} QueryBatchStats;
+
+typedef struct QueryExecutor QueryExecutor;
+
+QueryExecutor*  query_exec_create(const Graph* g, const PQOps* ops, int num_threads);
+// Worker t (0 <= t < num_threads) uses ops[t], e.g. its own pq_profile table,
+// so per-thread instrumentation needs no shared state.
+QueryExecutor*  query_exec_create_per_thread(const Graph* g, const PQOps* const* ops,
+                                             int num_threads);
+QueryBatchStats query_exec_run(QueryExecutor* ex, const int* sources, int count,
+                               QueryCallback cb, void* user);
+void            query_exec_destroy(QueryExecutor* ex);
+
+#endif
@@ -0,0 +1,168 @@
+// radix_pq.c
+#include "radix_pq.h"
+#include <stdlib.h>
+#include <stdio.h>
+
+#define RADIX_BUCKETS 65 // bucket 0 holds key == last, bucket b holds keys whose highest bit differing from last is b-1
+
+struct PQ {
+    int cap;
+    int size;
+    long long last;           // last extracted key (monotone lower bound)
+    int head[RADIX_BUCKETS];  // head of each bucket's doubly linked list
+    long long* key;           // key[v]
+    int* bucket;              // bucket[v], -1 if not in heap
+    int* next;
+    int* prev;
+};
+
+static int radix_bucket_of(const PQ* pq, long long key) {
+    unsigned long long x = (unsigned long long)key ^ (unsigned long long)pq->last;
+    return x == 0 ? 0 : 64 - __builtin_clzll(x);
+}
+
+static void radix_link(PQ* pq, int v, int b) {
+    pq->bucket[v] = b;
+    pq->prev[v] = -1;
+    pq->next[v] = pq->head[b];
+    if (pq->head[b] >= 0) pq->prev[pq->head[b]] = v;
+    pq->head[b] = v;
+}
+
+static void radix_unlink(PQ* pq, int v) {
+    int b = pq->bucket[v];
+    if (pq->prev[v] >= 0) pq->next[pq->prev[v]] = pq->next[v];
+    else pq->head[b] = pq->next[v];
+    if (pq->next[v] >= 0) pq->prev[pq->next[v]] = pq->prev[v];
+    pq->bucket[v] = -1;
+}
+
+static void radix_check(const PQ* pq, int v, long long key) {
+    if (v < 0 || v >= pq->cap) {
+        fprintf(stderr, "radix heap: vertex %d outside capacity %d\n", v, pq->cap);
+        exit(1);
+    }
+    if (key < pq->last) {
+        fprintf(stderr, "radix heap: key %lld is below last extracted key %lld "
+                        "(non-monotone workload such as Prim is not supported)\n",
+                key, pq->last);
+        exit(1);
+    }
+}
+
+static PQ* radix_create(int capacity) {
+    PQ* pq = (PQ*)malloc(sizeof(PQ));
+    pq->cap = capacity > 0 ? capacity : 1;
+    pq->size = 0;
+    pq->last = 0;
+    for (int b = 0; b < RADIX_BUCKETS; b++) pq->head[b] = -1;
+    pq->key = (long long*)malloc(sizeof(long long) * pq->cap);
+    pq->bucket = (int*)malloc(sizeof(int) * pq->cap);
+    pq->next = (int*)malloc(sizeof(int) * pq->cap);
+    pq->prev = (int*)malloc(sizeof(int) * pq->cap);
+    for (int v = 0; v < pq->cap; v++) pq->bucket[v] = -1;
+    return pq;
+}
+
+static void radix_destroy(PQ* pq) {
+    free(pq->key);
+    free(pq->bucket);
+    free(pq->next);
+    free(pq->prev);
+    free(pq);
+}
+
+static PQHandle* radix_insert(PQ* pq, long long key, int value) {
+    radix_check(pq, value, key);
+    if (pq->bucket[value] >= 0) {
+        // Already queued: keep the smaller key
+        if (key >= pq->key[value]) return PQ_HANDLE_FROM_VERTEX(value);
+        radix_unlink(pq, value);
+    } else {
+        pq->size++;
+    }
+    pq->key[value] = key;
+    radix_link(pq, value, radix_bucket_of(pq, key));
+    return PQ_HANDLE_FROM_VERTEX(value);
+}
+
+static PQItem radix_extract_min(PQ* pq) {
+    if (pq->size == 0) {
+        fprintf(stderr, "extract_min on empty heap\n");
+        exit(1);
+    }
+    if (pq->head[0] < 0) {
+        // Find the first non-empty bucket, make its minimum the new `last`,
+        // and redistribute it; every item lands in a strictly lower bucket.
+        int b = 1;
+        while (pq->head[b] < 0) b++;
+
+        long long mn = pq->key[pq->head[b]];
+        for (int v = pq->head[b]; v >= 0; v = pq->next[v])
+            if (pq->key[v] < mn) mn = pq->key[v];
+        pq->last = mn;
+
+        int v = pq->head[b];
+        pq->head[b] = -1;
+        while (v >= 0) {
+            int nxt = pq->next[v];
+            radix_link(pq, v, radix_bucket_of(pq, pq->key[v]));
+            v = nxt;
+        }
+    }
+
+    int u = pq->head[0];
+    radix_unlink(pq, u);
+    pq->size--;
+
+    PQItem out = { pq->key[u], u };
+    return out;
+}
+
+static void radix_decrease_key(PQ* pq, PQHandle* h, long long new_key) {
+    int v = PQ_HANDLE_TO_VERTEX(h);
+    radix_check(pq, v, new_key);
+    if (pq->bucket[v] < 0) {
+        fprintf(stderr, "decrease_key on vertex %d not in heap\n", v);
+        exit(1);
+    }
+    if (new_key > pq->key[v]) {
+        fprintf(stderr, "decrease_key called with larger key\n");
+        exit(1);
+    }
+    radix_unlink(pq, v);
+    pq->key[v] = new_key;
+    radix_link(pq, v, radix_bucket_of(pq, new_key));
+}
+
+// Inserts are O(1) here, so a batch is just a loop
+static void radix_build(PQ* pq, const PQItem* items, int count, PQHandle** handles) {
+    for (int i = 0; i < count; i++) {
+        PQHandle* h = radix_insert(pq, items[i].key, items[i].value);
+        if (handles) handles[i] = h;
+    }
+}
+
+static int radix_is_empty(PQ* pq) {
+    return pq->size == 0;
+}
+
+static void radix_clear(PQ* pq) {
+    for (int b = 0; b < RADIX_BUCKETS; b++) {
+        for (int v = pq->head[b]; v >= 0; v = pq->next[v]) pq->bucket[v] = -1;
+        pq->head[b] = -1;
+    }
+    pq->size = 0;
+    pq->last = 0;
+}
+
+const PQOps RADIX_OPS = {
+    .create = radix_create,
+    .destroy = radix_destroy,
+    .insert = radix_insert,
+    .extract_min = radix_extract_min,
+    .decrease_key = radix_decrease_key,
+    .build = radix_build,
+    .is_empty = radix_is_empty,
+    .clear = radix_clear
+};
@@ -0,0 +1,15 @@
+// radix_pq.h
+#ifndef RADIX_PQ_H
+#define RADIX_PQ_H
+
+#include "pq.h"
+
+// Monotone radix heap keyed by vertex id (values in [0, capacity)).
+// Keys must be non-negative integers and never smaller than the last
+// extracted key (true for Dijkstra with non-negative weights). Violations,
+// e.g. running prim_run on it, print an error and exit.
+// One entry per vertex: inserting a vertex that is already queued keeps the
+// smaller key (see PQ_HANDLE_FROM_VERTEX).
+extern const PQOps RADIX_OPS;
+
+#endif
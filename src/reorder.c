@@ -0,0 +1,156 @@
+// reorder.c
+#include "reorder.h"
+#include <stdlib.h>
+
+static int* degrees(const Graph* g) {
+    int* deg = (int*)calloc((size_t)g->n, sizeof(int));
+    for (int u = 0; u < g->n; u++) {
+        for (Edge* e = g->adj[u]; e; e = e->next) {
+            deg[u]++;
+            if (g->directed) deg[e->to]++;
+        }
+    }
+    return deg;
+}
+
+// Vertex ids sorted by degree (counting sort, ties by id)
+static int* sort_by_degree(int n, const int* deg, int descending) {
+    int max_deg = 0;
+    for (int v = 0; v < n; v++) if (deg[v] > max_deg) max_deg = deg[v];
+    int* start = (int*)calloc((size_t)max_deg + 2, sizeof(int));
+    for (int v = 0; v < n; v++) start[(descending ? max_deg - deg[v] : deg[v]) + 1]++;
+    for (int d = 1; d <= max_deg + 1; d++) start[d] += start[d - 1];
+    int* out = (int*)malloc(sizeof(int) * (size_t)n);
+    for (int v = 0; v < n; v++) out[start[descending ? max_deg - deg[v] : deg[v]]++] = v;
+    free(start);
+    return out;
+}
+
+static int cmp_ll(const void* a, const void* b) {
+    long long x = *(const long long*)a, y = *(const long long*)b;
+    return x < y ? -1 : x > y;
+}
+
+// Breadth-first order, starting from each still unvisited vertex of `starts`
+// (NULL: 0..n-1). When deg is given, the neighbours a vertex discovers are
+// queued by increasing degree (Cuthill-McKee).
+static int* bfs_order(const Graph* g, const int* starts, const int* deg) {
+    int n = g->n;
+    int* order = (int*)malloc(sizeof(int) * (size_t)n);
+    char* seen = (char*)calloc((size_t)n, 1);
+    long long* keys = deg ? (long long*)malloc(sizeof(long long) * (size_t)n) : NULL;
+    int head = 0, tail = 0;
+
+    for (int i = 0; i < n; i++) {
+        int s = starts ? starts[i] : i;
+        if (seen[s]) continue;
+        seen[s] = 1;
+        order[tail++] = s;
+        while (head < tail) {
+            int u = order[head++];
+            int first = tail;
+            for (Edge* e = g->adj[u]; e; e = e->next) {
+                if (seen[e->to]) continue;
+                seen[e->to] = 1;
+                order[tail++] = e->to;
+            }
+            if (deg && tail - first > 1) {
+                int k = tail - first;
+                for (int j = 0; j < k; j++) {
+                    int v = order[first + j];
+                    keys[j] = ((long long)deg[v] << 32) | (unsigned)v;
+                }
+                qsort(keys, (size_t)k, sizeof(long long), cmp_ll);
+                for (int j = 0; j < k; j++) order[first + j] = (int)(keys[j] & 0xffffffffLL);
+            }
+        }
+    }
+
+    free(keys);
+    free(seen);
+    return order;
+}
+
+Permutation* reorder_compute(const Graph* g, ReorderKind kind) {
+    int n = g->n;
+    int* order = NULL; // order[new id] = old id
+
+    if (kind == REORDER_BFS) {
+        order = bfs_order(g, NULL, NULL);
+    } else {
+        int* deg = degrees(g);
+        if (kind == REORDER_DEGREE) {
+            order = sort_by_degree(n, deg, 1);
+        } else {
+            // Cuthill-McKee from low-degree (peripheral-ish) vertices, reversed
+            int* starts = sort_by_degree(n, deg, 0);
+            order = bfs_order(g, starts, deg);
+            for (int i = 0, j = n - 1; i < j; i++, j--) {
+                int t = order[i];
+                order[i] = order[j];
+                order[j] = t;
+            }
+            free(starts);
+        }
+        free(deg);
+    }
+
+    Permutation* p = (Permutation*)malloc(sizeof(Permutation));
+    p->n = n;
+    p->old_id = order;
+    p->new_id = (int*)malloc(sizeof(int) * (size_t)n);
+    for (int i = 0; i < n; i++) p->new_id[order[i]] = i;
+    return p;
+}
+
+void permutation_destroy(Permutation* p) {
+    free(p->new_id);
+    free(p->old_id);
+    free(p);
+}
+
+Graph* graph_permute(const Graph* g, const Permutation* p) {
+    Graph* r = graph_create(g->n, g->directed);
+    Edge** arcs = NULL;
+    int cap = 0;
+    for (int nu = 0; nu < g->n; nu++) {
+        int k = 0;
+        for (Edge* e = g->adj[p->old_id[nu]]; e; e = e->next) {
+            if (k == cap) {
+                cap = cap ? cap * 2 : 16;
+                arcs = (Edge**)realloc(arcs, sizeof(Edge*) * (size_t)cap);
+            }
+            arcs[k++] = e;
+        }
+        // Arcs are prepended, so add in reverse to keep the original order
+        while (k-- > 0) graph_add_arc(r, nu, p->new_id[arcs[k]->to], arcs[k]->w);
+    }
+    free(arcs);
+    return r;
+}
+
+// Maps a parent array on new ids back to original ids (-1 stays -1)
+static int* restore_parent(const Permutation* p, const int* parent) {
+    int* out = (int*)malloc(sizeof(int) * (size_t)p->n);
+    for (int v = 0; v < p->n; v++) {
+        int q = parent[p->new_id[v]];
+        out[v] = q < 0 ? q : p->old_id[q];
+    }
+    return out;
+}
+
+void reorder_restore_dijkstra(const Permutation* p, DijkstraResult* r) {
+    long long* dist = (long long*)malloc(sizeof(long long) * (size_t)p->n);
+    for (int v = 0; v < p->n; v++) dist[v] = r->dist[p->new_id[v]];
+    int* parent = restore_parent(p, r->parent);
+    free(r->dist);
+    free(r->parent);
+    r->dist = dist;
+    r->parent = parent;
+}
+
+void reorder_restore_prim(const Permutation* p, PrimResult* r) {
+    int* parent = restore_parent(p, r->parent);
+    free(r->parent);
+    r->parent = parent;
+}
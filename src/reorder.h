@@ -0,0 +1,35 @@
+// reorder.h
+#ifndef REORDER_H
+#define REORDER_H
+
+#include "graph.h"
+#include "dijkstra.h"
+#include "prim.h"
+
+// Vertex relabeling for memory locality: vertices explored together get
+// nearby ids, so dist/parent/handle arrays and adjacency data are touched in
+// fewer cache lines and pages.
+typedef enum {
+    REORDER_BFS,    // breadth-first order, component by component
+    REORDER_RCM,    // reverse Cuthill-McKee (bandwidth reduction)
+    REORDER_DEGREE  // highest degree first (hubs packed together)
+} ReorderKind;
+
+typedef struct {
+    int n;
+    int* new_id; // new_id[original vertex]
+    int* old_id; // old_id[new vertex]
+} Permutation;
+
+Permutation* reorder_compute(const Graph* g, ReorderKind kind);
+void         permutation_destroy(Permutation* p);
+
+// Copy of g with vertex v renamed to p->new_id[v]. Each vertex keeps its
+// adjacency order, and edge nodes are allocated in new-id order.
+Graph* graph_permute(const Graph* g, const Permutation* p);
+
+// Rewrites a result computed on the permuted graph in original ids.
+void reorder_restore_dijkstra(const Permutation* p, DijkstraResult* r);
+void reorder_restore_prim(const Permutation* p, PrimResult* r);
+
+#endif
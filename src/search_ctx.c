@@ -0,0 +1,81 @@
+// search_ctx.c
+#include "search_ctx.h"
+#include <stdlib.h>
+#include <string.h>
+
+SearchContext* search_ctx_create(int n, const PQOps* ops) {
+    SearchContext* ctx = (SearchContext*)malloc(sizeof(SearchContext));
+    ctx->n = n;
+    ctx->ops = ops;
+    ctx->pq = pq_create(ops, n);
+    ctx->stamp = (unsigned*)calloc((size_t)n, sizeof(unsigned));
+    ctx->gen = 0;
+    ctx->dist = (long long*)malloc(sizeof(long long) * n);
+    ctx->parent = (int*)malloc(sizeof(int) * n);
+    ctx->handle = (PQHandle**)malloc(sizeof(PQHandle*) * n);
+    ctx->settled = 0;
+    ctx->touched = 0;
+    return ctx;
+}
+
+void search_ctx_destroy(SearchContext* ctx) {
+    ctx->ops->destroy(ctx->pq);
+    free(ctx->stamp);
+    free(ctx->dist);
+    free(ctx->parent);
+    free(ctx->handle);
+    free(ctx);
+}
+
+void search_ctx_begin(SearchContext* ctx) {
+    ctx->ops->clear(ctx->pq);
+    if (++ctx->gen == 0) {
+        // Stamp wrap-around (every 2^32 queries): one O(n) reset
+        memset(ctx->stamp, 0, sizeof(unsigned) * (size_t)ctx->n);
+        ctx->gen = 1;
+    }
+    ctx->settled = 0;
+    ctx->touched = 0;
+}
+
+int search_ctx_relax(SearchContext* ctx, int v, long long d, long long key, int parent) {
+    if (ctx->stamp[v] != ctx->gen) {
+        ctx->stamp[v] = ctx->gen;
+        ctx->dist[v] = DIJKSTRA_INF;
+        ctx->parent[v] = -1;
+        ctx->handle[v] = NULL;
+        ctx->touched++;
+    }
+    if (d >= ctx->dist[v]) return 0;
+
+    ctx->dist[v] = d;
+    ctx->parent[v] = parent;
+    if (ctx->handle[v] == NULL) ctx->handle[v] = ctx->ops->insert(ctx->pq, key, v);
+    else ctx->ops->decrease_key(ctx->pq, ctx->handle[v], key);
+    return 1;
+}
+
+int search_ctx_pop(SearchContext* ctx, int* v, long long* key) {
+    if (ctx->ops->is_empty(ctx->pq)) return 0;
+    PQItem it = ctx->ops->extract_min(ctx->pq);
+    ctx->handle[it.value] = NULL; // a later improvement re-inserts instead of decreasing
+    ctx->settled++;
+    *v = it.value;
+    *key = it.key;
+    return 1;
+}
+
+long long search_ctx_run(SearchContext* ctx, const Graph* g, int s, int t, long long radius) {
+    search_ctx_begin(ctx);
+    search_ctx_relax(ctx, s, 0, 0, -1);
+
+    int u;
+    long long du;
+    while (search_ctx_pop(ctx, &u, &du)) {
+        if (du > radius) break;
+        if (u == t) return du;
+        for (Edge* e = g->adj[u]; e; e = e->next)
+            search_ctx_relax(ctx, e->to, du + e->w, du + e->w, u);
+    }
+    return DIJKSTRA_INF; // t unreachable or beyond radius
+}
@@ -0,0 +1,52 @@
+// search_ctx.h
+#ifndef SEARCH_CTX_H
+#define SEARCH_CTX_H
+
+#include "graph.h"
+#include "pq.h"
+#include "dijkstra.h"
+
+// Reusable label-setting search state for many small queries on one graph.
+// Per-vertex entries carry a generation stamp: an entry whose stamp differs
+// from the current generation reads as "unreached", so starting a query costs
+// O(1) (plus clearing the heap) instead of O(n), and a query only touches the
+// vertices it reaches. Works with any PQOps backend that provides clear().
+typedef struct {
+    int n;
+    const PQOps* ops;
+    PQ* pq;
+    unsigned* stamp;   // stamp[v] == gen: dist/parent/handle of v are valid
+    unsigned gen;
+    long long* dist;
+    int* parent;
+    PQHandle** handle; // NULL once v is popped
+    int settled;       // vertices popped in the current query
+    int touched;       // vertices reached in the current query
+} SearchContext;
+
+SearchContext* search_ctx_create(int n, const PQOps* ops);
+void search_ctx_destroy(SearchContext* ctx);
+
+// Starts a new query (invalidates all previous labels).
+void search_ctx_begin(SearchContext* ctx);
+
+static inline long long search_ctx_dist(const SearchContext* ctx, int v) {
+    return ctx->stamp[v] == ctx->gen ? ctx->dist[v] : DIJKSTRA_INF;
+}
+
+static inline int search_ctx_parent(const SearchContext* ctx, int v) {
+    return ctx->stamp[v] == ctx->gen ? ctx->parent[v] : -1;
+}
+
+// Lowers v's tentative distance to d with queue key `key` (key == d for
+// Dijkstra; d plus a potential for A*). Returns 1 if the label improved.
+int search_ctx_relax(SearchContext* ctx, int v, long long d, long long key, int parent);
+
+// Pops the vertex with the smallest key. Returns 0 when the queue is empty.
+int search_ctx_pop(SearchContext* ctx, int* v, long long* key);
+
+// Dijkstra from s over g. Stops once t is settled (t < 0: no target) or the
+// next key exceeds radius. Returns the distance to t, or DIJKSTRA_INF.
+long long search_ctx_run(SearchContext* ctx, const Graph* g, int s, int t, long long radius);
+
+#endif
@@ -0,0 +1,67 @@
+// sssp_tree.c
+#include "sssp_tree.h"
+#include "dijkstra.h"
+#include <stdlib.h>
+
+#define INF DIJKSTRA_INF
+#define TREE_PARALLEL_CUTOFF 4096 // smaller graphs run the pass on the caller
+
+typedef struct {
+    const CSRGraph* g;
+    const long long* dist;
+    int* parent;
+} TreeState;
+
+static void tree_work(void* ctx, int tid, int nthreads) {
+    TreeState* st = (TreeState*)ctx;
+    const int* off = st->g->offsets;
+    const int* to = st->g->targets;
+    const int* wt = st->g->weights;
+    int lo, hi;
+    team_block(st->g->n, tid, nthreads, &lo, &hi);
+
+    // Races only choose between strictly closer tight predecessors
+    for (int u = lo; u < hi; u++) {
+        long long du = st->dist[u];
+        if (du >= INF) continue;
+        for (int k = off[u]; k < off[u + 1]; k++) {
+            int v = to[k];
+            if (wt[k] > 0 && du + wt[k] == st->dist[v])
+                __atomic_store_n(&st->parent[v], u, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+void sssp_tree_parents(const CSRGraph* g, int source, const long long* dist,
+                       int* parent, ThreadTeam* team) {
+    int n = g->n;
+    for (int v = 0; v < n; v++) parent[v] = -1;
+
+    TreeState st = { g, dist, parent };
+    if (n < TREE_PARALLEL_CUTOFF || !team) tree_work(&st, 0, 1);
+    else team_run(team, tree_work, &st);
+    parent[source] = -1;
+
+    int missing = 0;
+    for (int v = 0; v < n; v++)
+        if (v != source && dist[v] < INF && parent[v] < 0) missing++;
+    if (missing == 0) return;
+
+    // Zero-weight fix-up: grow from every attached vertex along tight 0 arcs.
+    // Each newly attached vertex hangs off one attached earlier, so no cycles.
+    int* queue = (int*)malloc(sizeof(int) * (size_t)n);
+    int head = 0, tail = 0;
+    for (int v = 0; v < n; v++)
+        if (v == source || parent[v] >= 0) queue[tail++] = v;
+    while (head < tail && missing > 0) {
+        int u = queue[head++];
+        for (int k = g->offsets[u]; k < g->offsets[u + 1]; k++) {
+            int v = g->targets[k];
+            if (g->weights[k] != 0 || v == source || parent[v] >= 0 || dist[v] != dist[u]) continue;
+            parent[v] = u;
+            queue[tail++] = v;
+            missing--;
+        }
+    }
+    free(queue);
+}
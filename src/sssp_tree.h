@@ -0,0 +1,17 @@
+// sssp_tree.h
+#ifndef SSSP_TREE_H
+#define SSSP_TREE_H
+
+#include "csr_graph.h"
+#include "thread_team.h"
+
+// Shortest-path tree from final distances (DIJKSTRA_INF = unreachable) for
+// the parallel SSSP engines, which settle dist without a consistent parent.
+// A parallel pass takes any tight predecessor u with dist[u] < dist[v], which
+// can never close a cycle; vertices reached only over zero-weight edges are
+// then attached by a sequential search along tight zero-weight arcs.
+// parent[source] = -1, unreachable vertices -1.
+void sssp_tree_parents(const CSRGraph* g, int source, const long long* dist,
+                       int* parent, ThreadTeam* team);
+
+#endif
@@ -0,0 +1,111 @@
+// st_query.c
+#include "st_query.h"
+#include "dijkstra.h"
+#include <stdlib.h>
+
+#define INF DIJKSTRA_INF
+
+STResult dijkstra_st(const Graph* g, int s, int t, const PQOps* ops) {
+    int n = g->n;
+    long long* dist = (long long*)malloc(sizeof(long long) * n);
+    PQHandle** handle = (PQHandle**)calloc((size_t)n, sizeof(PQHandle*));
+    for (int i = 0; i < n; i++) dist[i] = INF;
+
+    STResult r = { INF, 0 };
+    PQ* pq = pq_create(ops, n);
+    dist[s] = 0;
+    handle[s] = ops->insert(pq, 0, s);
+
+    while (!ops->is_empty(pq)) {
+        PQItem it = ops->extract_min(pq);
+        int u = it.value;
+        long long du = it.key;
+        if (du != dist[u]) continue;
+
+        r.settled++;
+        if (u == t) { r.dist = du; break; } // early exit: t is final
+
+        for (Edge* e = g->adj[u]; e; e = e->next) {
+            int v = e->to;
+            long long nd = du + e->w;
+            if (nd < dist[v]) {
+                dist[v] = nd;
+                if (handle[v] == NULL) handle[v] = ops->insert(pq, nd, v);
+                else ops->decrease_key(pq, handle[v], nd);
+            }
+        }
+    }
+
+    ops->destroy(pq);
+    free(dist);
+    free(handle);
+    return r;
+}
+
+// One search direction of the bidirectional query
+typedef struct {
+    const Graph* g;
+    PQ* pq;
+    long long* dist;
+    PQHandle** handle;
+    long long last; // key of the last settled vertex (monotone)
+} Side;
+
+STResult bidijkstra_st(const Graph* g, const Graph* rev, int s, int t, const PQOps* ops) {
+    int n = g->n;
+    STResult r = { INF, 0 };
+    if (s == t) { r.dist = 0; r.settled = 1; return r; }
+
+    Side side[2] = {
+        { g,   pq_create(ops, n), NULL, NULL, 0 },
+        { rev, pq_create(ops, n), NULL, NULL, 0 },
+    };
+    for (int d = 0; d < 2; d++) {
+        side[d].dist = (long long*)malloc(sizeof(long long) * n);
+        side[d].handle = (PQHandle**)calloc((size_t)n, sizeof(PQHandle*));
+        for (int i = 0; i < n; i++) side[d].dist[i] = INF;
+    }
+    side[0].dist[s] = 0;
+    side[0].handle[s] = ops->insert(side[0].pq, 0, s);
+    side[1].dist[t] = 0;
+    side[1].handle[t] = ops->insert(side[1].pq, 0, t);
+
+    long long mu = INF; // best s-t path seen so far
+
+    while (!ops->is_empty(side[0].pq) && !ops->is_empty(side[1].pq)) {
+        // Advance the side that is behind, keeping the two balls balanced
+        int d = side[0].last <= side[1].last ? 0 : 1;
+        Side* me = &side[d];
+        Side* other = &side[1 - d];
+
+        PQItem it = ops->extract_min(me->pq);
+        int u = it.value;
+        long long du = it.key;
+        if (du != me->dist[u]) continue;
+        me->last = du;
+        r.settled++;
+
+        // Remaining heap keys are >= the last settled keys, so no shorter path is left
+        if (side[0].last + side[1].last >= mu) break;
+
+        for (Edge* e = me->g->adj[u]; e; e = e->next) {
+            int v = e->to;
+            long long nd = du + e->w;
+            if (nd < me->dist[v]) {
+                me->dist[v] = nd;
+                if (me->handle[v] == NULL) me->handle[v] = ops->insert(me->pq, nd, v);
+                else ops->decrease_key(me->pq, me->handle[v], nd);
+            }
+            if (other->dist[v] < INF && nd + other->dist[v] < mu)
+                mu = nd + other->dist[v];
+        }
+    }
+    r.dist = mu;
+
+    for (int d = 0; d < 2; d++) {
+        ops->destroy(side[d].pq);
+        free(side[d].dist);
+        free(side[d].handle);
+    }
+    return r;
+}
@@ -0,0 +1,20 @@
+// st_query.h
+#ifndef ST_QUERY_H
+#define ST_QUERY_H
+
+#include "graph.h"
+#include "pq.h"
+
+typedef struct {
+    long long dist; // DIJKSTRA_INF if t is unreachable
+    int settled;    // vertices settled (extracted) by the search
+} STResult;
+
+// Point-to-point Dijkstra: stops as soon as t is settled.
+STResult dijkstra_st(const Graph* g, int s, int t, const PQOps* ops);
+
+// Bidirectional Dijkstra: forward on g->adj, backward on rev (from
+// graph_reverse, built once per graph). Works with any PQOps backend.
+STResult bidijkstra_st(const Graph* g, const Graph* rev, int s, int t, const PQOps* ops);
+
+#endif
@@ -0,0 +1,53 @@
+// stats.c
+#include "stats.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int cmp_double(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return x < y ? -1 : x > y;
+}
+
+static double median_sorted(const double* s, int n) {
+    return n % 2 ? s[n / 2] : 0.5 * (s[n / 2 - 1] + s[n / 2]);
+}
+
+SampleStats sample_stats(const double* x, int count) {
+    SampleStats st;
+    memset(&st, 0, sizeof(st));
+    st.count = count;
+    if (count <= 0) return st;
+
+    double* s = (double*)malloc(sizeof(double) * (size_t)count);
+    memcpy(s, x, sizeof(double) * (size_t)count);
+    qsort(s, (size_t)count, sizeof(double), cmp_double);
+
+    st.min = s[0];
+    st.max = s[count - 1];
+    double sum = 0;
+    for (int i = 0; i < count; i++) sum += s[i];
+    st.mean = sum / count;
+    st.median = median_sorted(s, count);
+
+    // Ranks n/2 -+ 1.96 sqrt(n)/2 bound the median with ~95% confidence
+    if (count < 6) {
+        st.ci_lo = st.min;
+        st.ci_hi = st.max;
+    } else {
+        double half = 1.96 * sqrt((double)count) / 2.0;
+        int lo = (int)floor(count / 2.0 - half);
+        int hi = (int)ceil(count / 2.0 + half);
+        if (lo < 0) lo = 0;
+        if (hi > count - 1) hi = count - 1;
+        st.ci_lo = s[lo];
+        st.ci_hi = s[hi];
+    }
+
+    for (int i = 0; i < count; i++) s[i] = fabs(s[i] - st.median);
+    qsort(s, (size_t)count, sizeof(double), cmp_double);
+    st.mad = median_sorted(s, count);
+
+    free(s);
+    return st;
+}
@@ -0,0 +1,19 @@
+// stats.h
+#ifndef STATS_H
+#define STATS_H
+
+// Robust summary of repeated measurements (e.g. per-trial run times).
+typedef struct {
+    int count;
+    double median;
+    double mad;    // median absolute deviation from the median
+    double ci_lo;  // ~95% confidence interval of the median from order
+    double ci_hi;  // statistics (distribution-free); [min, max] below 6 samples
+    double min;
+    double max;
+    double mean;
+} SampleStats;
+
+SampleStats sample_stats(const double* x, int count);
+
+#endif
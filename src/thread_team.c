@@ -0,0 +1,73 @@
+// thread_team.c
+#include "thread_team.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+
+struct ThreadTeam {
+    int nthreads;
+    pthread_t* threads;
+    pthread_barrier_t start, done;
+    TeamTask task;   // NULL tells workers to exit
+    void* ctx;
+    void** args;     // per worker: { team, tid }
+};
+
+static void* team_worker(void* arg) {
+    void** a = (void**)arg;
+    ThreadTeam* team = (ThreadTeam*)a[0];
+    int tid = (int)(intptr_t)a[1];
+    for (;;) {
+        pthread_barrier_wait(&team->start);
+        if (!team->task) break;
+        team->task(team->ctx, tid, team->nthreads);
+        pthread_barrier_wait(&team->done);
+    }
+    return NULL;
+}
+
+ThreadTeam* team_create(int nthreads) {
+    ThreadTeam* team = (ThreadTeam*)malloc(sizeof(ThreadTeam));
+    team->nthreads = nthreads > 0 ? nthreads : 1;
+    team->threads = (pthread_t*)malloc(sizeof(pthread_t) * (size_t)team->nthreads);
+    team->args = (void**)malloc(sizeof(void*) * 2 * (size_t)team->nthreads);
+    team->task = NULL;
+    team->ctx = NULL;
+    pthread_barrier_init(&team->start, NULL, (unsigned)team->nthreads);
+    pthread_barrier_init(&team->done, NULL, (unsigned)team->nthreads);
+    for (int t = 1; t < team->nthreads; t++) {
+        team->args[2 * t] = team;
+        team->args[2 * t + 1] = (void*)(intptr_t)t;
+        pthread_create(&team->threads[t], NULL, team_worker, &team->args[2 * t]);
+    }
+    return team;
+}
+
+void team_run(ThreadTeam* team, TeamTask task, void* ctx) {
+    if (team->nthreads == 1) {
+        task(ctx, 0, 1);
+        return;
+    }
+    team->task = task;
+    team->ctx = ctx;
+    pthread_barrier_wait(&team->start);
+    task(ctx, 0, team->nthreads);
+    pthread_barrier_wait(&team->done);
+}
+
+int team_size(const ThreadTeam* team) {
+    return team->nthreads;
+}
+
+void team_destroy(ThreadTeam* team) {
+    if (team->nthreads > 1) {
+        team->task = NULL;
+        pthread_barrier_wait(&team->start);
+        for (int t = 1; t < team->nthreads; t++) pthread_join(team->threads[t], NULL);
+    }
+    pthread_barrier_destroy(&team->start);
+    pthread_barrier_destroy(&team->done);
+    free(team->threads);
+    free(team->args);
+    free(team);
+}
@@ -0,0 +1,22 @@
+// thread_team.h
+#ifndef THREAD_TEAM_H
+#define THREAD_TEAM_H
+
+// Fork-join team of persistent worker threads. team_run executes a task on
+// every member (the calling thread is member 0) and returns when all are done.
+typedef void (*TeamTask)(void* ctx, int tid, int nthreads);
+
+typedef struct ThreadTeam ThreadTeam;
+
+ThreadTeam* team_create(int nthreads);
+void        team_run(ThreadTeam* team, TeamTask task, void* ctx);
+int         team_size(const ThreadTeam* team);
+void        team_destroy(ThreadTeam* team);
+
+// Block partition [lo, hi) of n items for member tid.
+static inline void team_block(int n, int tid, int nthreads, int* lo, int* hi) {
+    *lo = (int)((long long)n * tid / nthreads);
+    *hi = (int)((long long)n * (tid + 1) / nthreads);
+}
+
+#endif
@@ -0,0 +1,38 @@
+// timer.h
+#ifndef TIMER_H
+#define TIMER_H
+
+#include <stdint.h>
+
+// Monotonic wall clock in nanoseconds, plus the online CPU count.
+#ifdef _WIN32
+#include <windows.h>
+static inline uint64_t now_ns(void) {
+    static LARGE_INTEGER freq;
+    static int init = 0;
+    if (!init) { QueryPerformanceFrequency(&freq); init = 1; }
+    LARGE_INTEGER t;
+    QueryPerformanceCounter(&t);
+    // convert ticks to ns
+    return (uint64_t)((1e9 * (double)t.QuadPart) / (double)freq.QuadPart);
+}
+static inline int cpu_count(void) {
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    return (int)si.dwNumberOfProcessors;
+}
+#else
+#include <time.h>
+#include <unistd.h>
+static inline uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+static inline int cpu_count(void) {
+    long c = sysconf(_SC_NPROCESSORS_ONLN);
+    return c > 0 ? (int)c : 1;
+}
+#endif
+
+#endif
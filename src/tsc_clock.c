@@ -0,0 +1,38 @@
+// tsc_clock.c
+#include "tsc_clock.h"
+
+#define CALIBRATE_NS 20000000ull
+#define OVERHEAD_REPS 10000
+
+void tsc_calibrate(TscClock* clk) {
+#if defined(__x86_64__) || defined(__i386__) || defined(__aarch64__)
+    clk->hardware = 1;
+#else
+    clk->hardware = 0;
+#endif
+
+    // Rate: ticks elapsed over a spin of known wall-clock length
+    uint64_t w0 = now_ns(), c0 = tsc_read();
+    uint64_t w1;
+    do { w1 = now_ns(); } while (w1 - w0 < CALIBRATE_NS);
+    uint64_t c1 = tsc_read();
+    clk->ns_per_tick = c1 > c0 ? (double)(w1 - w0) / (double)(c1 - c0) : 1.0;
+
+    // Overhead: the smallest back-to-back difference is what every sample
+    // carries on top of the operation itself
+    uint64_t best = UINT64_MAX;
+    uint64_t start = tsc_read();
+    for (int i = 0; i < OVERHEAD_REPS; i++) {
+        uint64_t a = tsc_read();
+        uint64_t b = tsc_read();
+        if (b - a < best) best = b - a;
+    }
+    clk->read_ns = (double)(tsc_read() - start) * clk->ns_per_tick / (2.0 * OVERHEAD_REPS + 1.0);
+    clk->overhead_ticks = best;
+
+    uint64_t t0 = now_ns();
+    volatile uint64_t sink = 0;
+    for (int i = 0; i < OVERHEAD_REPS; i++) sink += now_ns();
+    (void)sink;
+    clk->clock_read_ns = (double)(now_ns() - t0) / (OVERHEAD_REPS + 1.0);
+}
@@ -0,0 +1,39 @@
+// tsc_clock.h
+#ifndef TSC_CLOCK_H
+#define TSC_CLOCK_H
+
+#include <stdint.h>
+#include "timer.h"
+
+// Cheap cycle-counter timestamps for per-operation profiling: rdtsc on x86,
+// the virtual counter on AArch64, now_ns() elsewhere. Reads are not
+// serializing, so single samples jitter by a few tens of cycles; they are
+// meant for histograms and sums over many operations, not one-off timings.
+static inline uint64_t tsc_read(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    uint32_t lo, hi;
+    __asm__ __volatile__("rdtsc" : "=a"(lo), "=d"(hi));
+    return ((uint64_t)hi << 32) | lo;
+#elif defined(__aarch64__)
+    uint64_t v;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(v));
+    return v;
+#else
+    return now_ns();
+#endif
+}
+
+typedef struct {
+    double ns_per_tick;
+    uint64_t overhead_ticks; // cost of an empty tsc_read() pair, subtracted from samples
+    double read_ns;          // cost of one tsc_read()
+    double clock_read_ns;    // cost of one now_ns(), for comparison
+    int hardware;            // 0: tsc_read() falls back to now_ns()
+} TscClock;
+
+// Measures the tick rate against now_ns() over ~20 ms and the read costs.
+// Assumes an invariant TSC (constant rate, synchronized across cores), which
+// holds on current x86 and ARM servers.
+void tsc_calibrate(TscClock* clk);
+
+#endif